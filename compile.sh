@@ -106,13 +106,6 @@ mv -f systemModel.hpp ./include/models/
 # parsing completed
 echo -e "${GR}[+] Parsing completed.${NC}"
 
-# check if user want access to resource availability
-if grep -q "available_instance" "$input"; then
-    echo -e "${BL}--> Enabling resource availability access${NC}"
-    # enable resource availability access option in cmake
-    cmake_options="-DRESOURCE_ACCESS=ON"
-fi
-
 # compile ReTA framework
 echo -e "${BL}--> Compiling ReTA framework${NC}"
 mkdir -p build
@@ -120,7 +113,7 @@ rm -rf build/*
 cd build || exit
 
 # check for errors and print error message if any
-if ! cmake .. ${cmake_options}; then
+if ! cmake ..; then
     echo -e "${RED}[!] CMake failed.${NC}"
     exit 1
 fi
@@ -14,8 +14,13 @@ from template import (cpp_model_template, cpp_scheduler_template)
 from docopt import docopt
 from pathlib import Path
 import os
+import hashlib
 
 read_from_file = False
+# processor names in the order of their cluster IDs
+processor_ids = []
+# task names in the order of their task IDs
+task_ids = []
 
 
 def interpret(model):
@@ -74,7 +79,7 @@ def interpret(model):
 
     # write processors to header file
     procs = ""
-    procsID = []
+    procsID = processor_ids
     for r in model.resources.resource:
         procs += "\t\tprocessors.emplace_back(\"" + r.name + \
                  "\", processorCounter++, " + str(r.ncores) + ");" + "\n"
@@ -86,6 +91,7 @@ def interpret(model):
     jobs = ""
     for t in model.workloads.workload:
         if t.type == "task":
+            task_ids.append(t.name)
             tasks += "\t\ttasks.emplace_back(\"" + t.name + "\", taskCounter++, " + str(t.jitter) + ", " + str(
                 t.period) + ", Interval<time>(" + str(t.cost_low) + "," + str(t.cost_up) + "), " + str(
                 t.deadline) + ", " + str(procsID.index(t.processor.name)) + ", " + str(t.priority) + ");" + "\n"
@@ -107,6 +113,9 @@ def interpret(model):
     # call scheduler commands handler
     scheduler_commands_handler(model.scheduler.commands)
 
+    # derive the compile-time properties of the policy
+    policy_traits_handler(model.scheduler.commands)
+
     if read_from_file:
         f.writelines(imported_file.read())
         print("imported file")
@@ -182,6 +191,73 @@ def scheduler_commands_handler(commands, line_tabs="\t\t"):
         elif c.__class__.__name__ == "Loop_statement":
             loop_handler(c, line_tabs)
 
+def sort_then_pick(commands):
+    """returns (key, front) if the policy only sorts the ready queue and returns its front or back"""
+    body = [c for c in commands if c.__class__.__name__ != "Ready_queue_declaration"]
+    if len(body) != 2:
+        return None
+    sort, ret = body
+    if sort.__class__.__name__ != "Queue_command" or sort.command is None or sort.command.name != "sort":
+        return None
+    if ret.__class__.__name__ != "Return" or ret.func is None or ret.func.func.name not in ("front", "back"):
+        return None
+    return sort.command.key, ret.func.func.name == "front"
+
+
+def policy_traits_handler(commands):
+    """emits compile-time properties of the scheduling policy used by the analysis engine"""
+    body = cpp_scheduler_template[14]
+
+    # the policy reads the current time directly or through laxity and next_deadline()
+    reads_current_time = "currentTime" in body
+    # the policy reads the number of available cores through available_instance()
+    reads_available_resources = "availableResources" in body
+
+    traits = "\n\t// policy traits (generated by the DSL parser)\n"
+    traits += "\tstatic constexpr bool readsCurrentTime = " + \
+              ("true" if reads_current_time else "false") + ";\n"
+    traits += "\tstatic constexpr bool readsAvailableResources = " + \
+              ("true" if reads_available_resources else "false") + ";\n"
+
+    # sort-then-pick policies can be evaluated in batches
+    pick = sort_then_pick(commands)
+    traits += "\tstatic constexpr bool sortThenPick = " + ("true" if pick is not None else "false") + ";\n"
+    if pick is not None:
+        traits += "\tstatic constexpr sortKey pickKey = sortKey::" + pick[0] + ";\n"
+        traits += "\tstatic constexpr bool pickFront = " + ("true" if pick[1] else "false") + ";\n"
+
+    # the policy makes the same decisions if all time parameters are divided by a common factor
+    # (it does not compare time values with constants)
+    time_scale_invariant = pick is not None or not (
+            reads_current_time or "getWcet" in body or "getMaximalCost" in body)
+    traits += "\tstatic constexpr bool timeScaleInvariant = " + ("true" if time_scale_invariant else "false") + ";\n"
+
+    # the decision for the jobs of one cluster does not depend on the jobs and cores of other clusters
+    # (a sort-then-pick policy always selects the best job, which is also the best job of its own cluster)
+    cluster_independent = pick is not None and not reads_available_resources
+    traits += "\tstatic constexpr bool clusterIndependent = " + ("true" if cluster_independent else "false") + ";\n"
+
+    # job-level fixed priority and work-conserving: the sort keys (laxity included) order two jobs the same way
+    # at any time and a non-empty ready queue always yields a job
+    traits += "\tstatic constexpr bool jobLevelFixedPriority = " + ("true" if pick is not None else "false") + ";\n"
+
+    # the policy looks up tasks in the task table, which is built from the jobs given to the scheduler
+    reads_task_table = "getNextDeadline(" in body or "getWcet(" in body
+    traits += "\tstatic constexpr bool readsTaskTable = " + ("true" if reads_task_table else "false") + ";\n"
+
+    # the job parameters the policy reads (in its sort keys, through the WCET of a job or of a task)
+    reads_arrival = "sortKey::arrival_min" in body or "sortKey::arrival_max" in body
+    reads_cost = ("sortKey::cost_min" in body or "sortKey::cost_max" in body or "sortKey::laxity" in body
+                  or "getMaximalCost" in body or reads_task_table)
+    traits += "\tstatic constexpr bool readsArrival = " + ("true" if reads_arrival else "false") + ";\n"
+    traits += "\tstatic constexpr bool readsCost = " + ("true" if reads_cost else "false") + ";\n"
+
+    # a hash of the policy and its traits, the analysis does not resume from the frontiers of another policy
+    fingerprint = int(hashlib.sha256((body + traits).encode()).hexdigest()[:16], 16) or 1
+    traits += "\tstatic constexpr unsigned long long fingerprint = " + hex(fingerprint) + "ULL;\n"
+    cpp_scheduler_template[16] = traits
+
+
 def variable_handler(command, line_tabs):
     """variable declaration and assignment handler"""
     if command.__class__.__name__ == "Variable_declaration":
@@ -210,15 +286,7 @@ def variable_handler(command, line_tabs):
             elif command.rhs.__class__.__name__ == "Resource_function":
                 cpp_scheduler_template[14] += line_tabs + command.var.var_type + \
                                               " " + command.var.name + \
-                                              " = availableResources.find(\"" + str(
-                    command.rhs.resource.name) + "\")->second;" + "\n"
-
-            elif command.rhs.__class__.__name__ == "Task_function":
-                # TODO: implement task function
-                if command.rhs.func.name == "next_deadline":
-                    pass
-                elif command.rhs.func.name == "wcet":
-                    pass
+                                              " = " + resource_function_handler(command.rhs) + ";" + "\n"
 
             elif command.rhs.__class__.__name__ == "Operation":
                 cpp_scheduler_template[14] += line_tabs +command.var.var_type + \
@@ -266,17 +334,10 @@ def variable_handler(command, line_tabs):
                 exit(1)
         elif command.rhs.__class__.__name__ == "Resource_function":
             cpp_scheduler_template[14] += line_tabs + command.ref.name + \
-                                          " = availableResources.find(\"" + \
-                                          str(command.rhs.resource.name) + "\")->second;" + "\n"
+                                          " = " + resource_function_handler(command.rhs) + ";" + "\n"
         elif command.rhs.__class__.__name__ == "Task_function":
-            if command.rhs.func.name == "next_deadline":
-                cpp_scheduler_template[14] += line_tabs + command.ref.name + " = " + \
-                                              " getNextDeadline( \"" + command.rhs.task.name + \
-                                              "\",currentTime);" + "\n"
-            elif command.rhs.func.name == "wcet":
-                cpp_scheduler_template[14] += line_tabs + command.ref.name + " = " + \
-                                              " segmentsByID.at(getJobID(\"" + command.rhs.task.name + \
-                                              "\")).getMaximalCost();" + "\n"
+            cpp_scheduler_template[14] += line_tabs + command.ref.name + \
+                                          " = " + task_function_handler(command.rhs) + ";" + "\n"
         elif command.rhs.__class__.__name__ == "Current_time_function":
             cpp_scheduler_template[14] += line_tabs + \
                                           command.ref.name + " = currentTime;" + "\n"
@@ -305,11 +366,7 @@ def operation_handler(command):
     """operation handler"""
     if command.lhs is not None:
         if command.lhs.__class__.__name__ == "Task_function":
-            temp_command = ""
-            if command.lhs.func.name == "next_deadline":
-                temp_command += "getNextDeadline(\"" + command.lhs.task.name + "\",currentTime)"
-            elif command.lhs.func.name == "wcet":
-                temp_command += "segmentsByID.at(getJobID(\"" + command.lhs.task.name + "\")).getMaximalCost()"
+            temp_command = task_function_handler(command.lhs)
 
             if command.rhs.__class__.__name__ == "Operation":
                 return temp_command + " " + str(command.operator) + " " + operation_handler(command.rhs)
@@ -358,10 +415,7 @@ def operation_handler(command):
                 return str(command.lhs.value) + " " + command.operator + " " + str(command.rhs.value)
     else:
         if command.rhs.__class__.__name__ == "Task_function":
-            if command.rhs.func.name == "next_deadline":
-                return "getNextDeadline(\"" + command.rhs.task.name + "\",currentTime)"
-            elif command.rhs.func.name == "wcet":
-                return "segmentsByID.at(getJobID(\"" + command.rhs.task.name + "\")).getMaximalCost()"
+            return task_function_handler(command.rhs)
 
         elif command.rhs.__class__.__name__ == "Queue_function":
             if command.rhs.func.name == "length":
@@ -460,12 +514,37 @@ def expression_handler(expression):
             return str(expression.value)
     elif expression.__class__.__name__ == "Current_time_function":
         return "currentTime"
+    elif expression.__class__.__name__ == "Resource_function":
+        return resource_function_handler(expression)
     else:
         print(expression.__class__.__name__)
         print("Error: invalid expression!")
         exit(1)
 
 
+def resource_function_handler(command):
+    """handles resource functions and returns the corresponding C++ code"""
+    # available resources are indexed by the cluster ID of the processor
+    if command.func.name == "available_instance":
+        return "availableResources[" + str(processor_ids.index(command.resource.name)) + "]"
+    else:
+        print("Error: invalid resource function!")
+        exit(1)
+
+
+def task_function_handler(command):
+    """handles task functions and returns the corresponding C++ code"""
+    # task names are resolved to task IDs here, the scheduler looks them up in its task table
+    task_index = str(task_ids.index(command.task.name))
+    if command.func.name == "next_deadline":
+        return "getNextDeadline(" + task_index + ", currentTime)"
+    elif command.func.name == "wcet":
+        return "getWcet(" + task_index + ")"
+    else:
+        print("Error: invalid task function!")
+        exit(1)
+
+
 def queue_function_handler(command):
     """handles queue functions and returns the corresponding C++ code"""
     if command.func.name == "length":
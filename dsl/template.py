@@ -38,11 +38,21 @@ cpp_scheduler_template = ["#ifndef SCHEDULER_HPP\n#define SCHEDULER_HPP\n\n",
                           "#include <vector>\n#include <algorithm>\n#include <optional>\n#include \"job.hpp\"\n#include \"queue.hpp\"\n\n",
                           "template<class Time>\nclass scheduler {\n",
                           "\ttypedef std::unordered_map<jobID, job<Time>> segmentMap;\n",
-                          "\tsegmentMap segmentsByID;\n\n",
+                          "\tsegmentMap segmentsByID;\n\n"
+                          "\tstruct taskParameters {\n\t\tTime period;\n\t\tTime wcet;\n\t};\n"
+                          "\tstd::vector<taskParameters> tasks;\n\n",
                           "public:\n",
                           "\tscheduler() = default;\n\n",
-                          "\tscheduler(segmentMap segments) : segmentsByID(segments) { }\n\n",
-                          "\tstd::optional<jobID> callScheduler(queue<Time> &readyQueue, const std::unordered_map<std::string, unsigned int> &availableResources, Time currentTime) {\n",
+                          "\tscheduler(segmentMap segments) : segmentsByID(segments) {\n"
+                          "\t\t// task table indexed by task ID\n"
+                          "\t\tfor (const auto &p: segmentsByID) {\n"
+                          "\t\t\tif (p.first.task >= tasks.size()) {\n"
+                          "\t\t\t\ttasks.resize(p.first.task + 1);\n"
+                          "\t\t\t}\n"
+                          "\t\t\ttasks[p.first.task] = {p.second.getTaskPeriod(), p.second.getMaximalCost()};\n"
+                          "\t\t}\n"
+                          "\t}\n\n",
+                          "\tstd::optional<jobID> callScheduler(queue<Time> &readyQueue, const std::vector<unsigned int> &availableResources, Time currentTime) {\n",
                           "\t\t// if the queue is empty, return an empty optional\n",
                           "\t\tif (readyQueue.empty()) {\n",
                           "\t\t\treturn std::nullopt;\n",
@@ -51,17 +61,17 @@ cpp_scheduler_template = ["#ifndef SCHEDULER_HPP\n#define SCHEDULER_HPP\n\n",
                           # 14 - scheduling algorithm
                           "\n",
                           "\n\t}\n",
-                          "\n\tTime getNextDeadline(std::string taskName, Time currentTime) {\n",
-                          "\t\tauto job = segmentsByID.at(getJobID(taskName));\n",
+                          # 16 - policy traits
+                          "\n",
+                          "\n\t// next period boundary of a task minus its WCET\n",
+                          "\tTime getNextDeadline(std::size_t taskIndex, Time currentTime) const {\n",
+                          "\t\tconst taskParameters &t = tasks.at(taskIndex);\n",
                           "\t\tTime nextDeadline =\n",
-                          "\t\tstd::floor(currentTime / job.getTaskPeriod() + 1) * job.getTaskPeriod() - job.getMaximalCost();\n"
+                          "\t\tstd::floor(currentTime / t.period + 1) * t.period - t.wcet;\n"
                           "\t\treturn nextDeadline;\n\t}",
                           "\n",
-                          "\n\tjobID getJobID(std::string taskName) {\n",
-                          "\t\tauto it = std::find_if(segmentsByID.begin(), segmentsByID.end(),\n"
-                          "\t\t\t[taskName](const std::pair<jobID, job<Time>> &p) {\n"
-                          "\t\t\t\t\treturn p.second.getTaskName() == taskName;\n\t\t\t\t});\n",
-                          "\t\treturn it->first;\n\t}\n",
+                          "\n\tTime getWcet(std::size_t taskIndex) const {\n",
+                          "\t\treturn tasks.at(taskIndex).wcet;\n\t}\n",
                           "};\n\n#endif"
                           ]
 
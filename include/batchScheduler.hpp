@@ -0,0 +1,114 @@
+#ifndef BATCH_SCHEDULER_HPP
+#define BATCH_SCHEDULER_HPP
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <algorithm>
+#include <unordered_map>
+#include "job.hpp"
+#include "queue.hpp"
+
+// batched evaluation of sort-then-pick policies (sort the ready queue by a static key, return front or back)
+// all candidate ready queues of a state are evaluated at once: the candidates are given in the order
+// of the policy (key, then job ID like in queue::sort), each queue is a bitmask over the candidates
+// and its selected job is the lowest (highest for back) set bit of its mask
+template<class Time>
+class batchScheduler {
+	typedef std::vector<jobID> readyQueue;
+	typedef std::vector<readyQueue> readyQueues;
+
+public:
+	// at most one 64-bit mask per queue
+	static constexpr std::size_t maxCandidates = 64;
+
+	batchScheduler() = default;
+
+	explicit batchScheduler(bool pickFront) : pickFront(pickFront) {
+	}
+
+	// the static key of a job; laxity orders jobs like deadline - cost at any given time
+	static Time keyOf(sortKey key, const job<Time> &j) {
+		switch (key) {
+			case arrival_min:
+				return j.getArrival().min();
+			case arrival_max:
+				return j.getArrival().max();
+			case cost_min:
+				return j.getCost().min();
+			case cost_max:
+				return j.getCost().max();
+			case deadline:
+				return j.getDeadline();
+			case priority:
+				return j.getPriority();
+			case period:
+				return j.getTaskPeriod();
+			case laxity:
+				return j.getDeadline() - j.getCost().max();
+		}
+		return 0;
+	}
+
+	// order of the jobs in the ready queue after sorting by the given key
+	static bool before(sortKey key, const job<Time> &a, const job<Time> &b) {
+		Time ka = keyOf(key, a);
+		Time kb = keyOf(key, b);
+		return ka < kb || (ka == kb && a.getID() < b.getID());
+	}
+
+	// select a job from each ready queue
+	// candidates: all jobs that appear in the queues in the order of the policy,
+	// returns false if the batch cannot be evaluated
+	bool decide(const readyQueues &queues, const readyQueue &candidates) {
+		if (candidates.size() > maxCandidates) {
+			return false;
+		}
+
+		// position of each candidate in the order of the policy, searchable by job ID
+		const std::size_t n = candidates.size();
+		positions.clear();
+		for (std::size_t i = 0; i < n; i++) {
+			positions.emplace_back(candidates[i], (unsigned int) i);
+		}
+		std::sort(positions.begin(), positions.end());
+
+		decisions.resize(queues.size());
+		for (std::size_t q = 0; q < queues.size(); q++) {
+			std::uint64_t m = 0;
+			for (const auto &id: queues[q]) {
+				auto it = std::lower_bound(positions.begin(), positions.end(), std::make_pair(id, 0u));
+				m |= ((std::uint64_t) 1) << it->second;
+			}
+			if (m == 0) {
+				decisions[q] = std::nullopt;
+			} else {
+				decisions[q] = candidates[pickFront ? __builtin_ctzll(m) : 63 - __builtin_clzll(m)];
+			}
+		}
+		numDecisions += queues.size();
+		return true;
+	}
+
+	// decisions of the last batch in the order of the ready queues
+	const std::vector<std::optional<jobID>> &getDecisions() const {
+		return decisions;
+	}
+
+	unsigned long getNumDecisions() const {
+		return numDecisions;
+	}
+
+	void absorbCounts(const batchScheduler &other) {
+		numDecisions += other.numDecisions;
+	}
+
+private:
+	bool pickFront = true;
+	std::vector<std::pair<jobID, unsigned int>> positions;
+	std::vector<std::optional<jobID>> decisions;
+	unsigned long numDecisions = 0;
+};
+
+#endif
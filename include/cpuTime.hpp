@@ -3,41 +3,54 @@
 
 #include <time.h>
 
+// CPU time of the calling thread: the analyses that run in parallel each measure (and time out on) their own
+// time, a timer that runs on several threads would count the time of all of them
 class cpuTime {
 
 	private:
 
-	clock_t accum = 0, start_time = 0;
+	double accum = 0, start_time = 0;
 	bool running = false;
 
-	static constexpr double scale_to_seconds = 1.0 / (double) CLOCKS_PER_SEC;
+	static double now()
+	{
+		timespec t;
+		clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+		return (double) t.tv_sec + (double) t.tv_nsec * 1e-9;
+	}
 
 	public:
 
 	void start()
 	{
 		running = true;
-		start_time = clock();
+		start_time = now();
 	}
 
 
 	double stop()
 	{
-		auto delta = clock() - start_time;
+		auto delta = now() - start_time;
 		if (running) {
 			accum += delta;
 			running = false;
-			return delta * scale_to_seconds;
+			return delta;
 		}
 		else
 			return 0;
 	}
 
+	// add the time of another timer (e.g., of an analysis that ran on another thread)
+	void add(const cpuTime &other)
+	{
+		accum += double(other);
+	}
+
 	operator double() const {
-		clock_t extra = 0;
+		double extra = 0;
 		if (running)
-			extra = clock() - start_time;
-		return (accum + extra) * scale_to_seconds;
+			extra = now() - start_time;
+		return accum + extra;
 	}
 
 };
@@ -0,0 +1,99 @@
+#ifndef DECISION_CACHE_HPP
+#define DECISION_CACHE_HPP
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <optional>
+#include <functional>
+#include "job.hpp"
+
+// bounded cache of scheduling decisions
+// key: (ready queue, available resources, time stamp) -- the time stamp is only part of the key
+// if the policy reads the current time, otherwise it is set to zero by the caller
+// the cache is direct-mapped: each key has exactly one slot and a colliding key overwrites it,
+// so the memory footprint never exceeds the given capacity
+// slots are protected by striped locks, so one cache can be shared by several exploration threads
+template<class Time>
+class decisionCache {
+public:
+	typedef std::optional<jobID> decision;
+
+	// order-sensitive hash of a key: the policy may not sort the ready queue
+	static std::size_t hashOf(const std::vector<jobID> &queue, const std::vector<unsigned int> &resources, Time time) {
+		std::hash<jobID> hj;
+		std::hash<unsigned int> hr;
+		std::size_t hash = std::hash<Time>{}(time);
+		for (const auto &id: queue)
+			hash = (hash * 0x100000001b3UL) ^ hj(id);
+		for (const auto &r: resources)
+			hash = (hash * 0x100000001b3UL) ^ hr(r);
+		return hash;
+	}
+
+	static constexpr std::size_t defaultCapacity = 1 << 14;
+
+	explicit decisionCache(std::size_t capacity = defaultCapacity)
+			: slots(std::max(capacity, numStripes)) {
+	}
+
+	// look up a decision, returns true on a hit
+	bool lookup(std::size_t hash, const std::vector<jobID> &queue, const std::vector<unsigned int> &resources,
+				Time time, decision &result) {
+		auto i = hash % slots.size();
+		std::lock_guard<std::mutex> guard(stripes[i % numStripes]);
+		const slot &sl = slots[i];
+		if (sl.valid && sl.hash == hash && sl.time == time && sl.queue == queue && sl.resources == resources) {
+			result = sl.value;
+			hits++;
+			return true;
+		}
+		misses++;
+		return false;
+	}
+
+	void store(std::size_t hash, const std::vector<jobID> &queue, const std::vector<unsigned int> &resources,
+			   Time time, decision value) {
+		auto i = hash % slots.size();
+		std::lock_guard<std::mutex> guard(stripes[i % numStripes]);
+		slot &sl = slots[i];
+		sl.hash = hash;
+		sl.queue = queue;
+		sl.resources = resources;
+		sl.time = time;
+		sl.value = value;
+		sl.valid = true;
+	}
+
+	unsigned long getHits() const {
+		return hits;
+	}
+
+	unsigned long getMisses() const {
+		return misses;
+	}
+
+	double getHitRate() const {
+		unsigned long total = hits + misses;
+		return total == 0 ? 0.0 : (double) hits / (double) total;
+	}
+
+private:
+	static constexpr std::size_t numStripes = 64;
+
+	struct slot {
+		bool valid = false;
+		std::size_t hash = 0;
+		std::vector<jobID> queue;
+		std::vector<unsigned int> resources;
+		Time time = 0;
+		decision value;
+	};
+
+	std::vector<slot> slots;
+	std::mutex stripes[numStripes];
+	std::atomic<unsigned long> hits{0};
+	std::atomic<unsigned long> misses{0};
+};
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef FRONTIER_STORE_HPP
+#define FRONTIER_STORE_HPP
+
+#include <set>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <limits>
+#include "job.hpp"
+#include "interval.hpp"
+#include "time.hpp"
+
+// frontiers of an exploration stored in a text file, so that the analysis of an edited model can resume
+// from the last frontier that the edit cannot have influenced
+// a snapshot is taken when the exploration (by time stamp) first reaches a checkpoint: the unexplored states,
+// the completion times known at that point, and the latest time that the exploration has looked at so far
+// (the time stamps of the states and the completion times of the dispatched jobs)
+template<class Time>
+class frontierStore {
+public:
+	// the parameters of a job that the exploration depends on
+	struct storedJob {
+		unsigned long task;
+		unsigned long job;
+		Time arrivalMin, arrivalMax, costMin, costMax, deadline, priority, period;
+		unsigned int cluster;
+		// the earliest time at which the job was dispatched (-1 if it was not)
+		Time earliestStart = -1;
+
+		storedJob() = default;
+
+		explicit storedJob(const ::job<Time> &j)
+				: task(j.getID().task), job(j.getID().job), arrivalMin(j.getArrival().min()),
+				  arrivalMax(j.getArrival().max()), costMin(j.getCost().min()), costMax(j.getCost().max()),
+				  deadline(j.getDeadline()), priority(j.getPriority()), period(j.getTaskPeriod()),
+				  cluster(j.getAssignedProcessorSet()) {
+		}
+
+		// a job misses its deadline if it starts strictly after this time
+		Time latestStart() const {
+			return deadline + timeModel::constants<Time>::deadlineMissTolerance() - costMax;
+		}
+
+		::job<Time> toJob() const {
+			::job<Time> j(task, job, Interval<Time>(arrivalMin, arrivalMax), Interval<Time>(costMin, costMax), deadline,
+						  cluster, priority);
+			j.setTaskPeriod(period);
+			return j;
+		}
+
+		bool sameJob(const storedJob &other) const {
+			return task == other.task && job == other.job;
+		}
+
+		bool operator==(const storedJob &other) const {
+			return std::tie(task, job, arrivalMin, arrivalMax, costMin, costMax, deadline, priority, period, cluster)
+				   == std::tie(other.task, other.job, other.arrivalMin, other.arrivalMax, other.costMin,
+							   other.costMax, other.deadline, other.priority, other.period, other.cluster);
+		}
+
+		bool operator!=(const storedJob &other) const {
+			return !(*this == other);
+		}
+	};
+
+	struct storedState {
+		Time timeStamp;
+		// indices of the dispatched jobs (sorted)
+		std::vector<std::size_t> dispatched;
+		std::vector<std::vector<Interval<Time>>> availability;
+		std::set<Time> events;
+	};
+
+	struct snapshot {
+		Time checkpoint;
+		Time lookahead;
+		// number of states created before the snapshot
+		unsigned long numStates;
+		// job index, earliest and latest completion time
+		std::vector<std::tuple<std::size_t, Time, Time>> completions;
+		std::vector<storedState> states;
+	};
+
+	// the system of the stored exploration
+	// (the fingerprint of the policy and the unit of the stored times, see tools::horizon)
+	unsigned long long scheduler = 0;
+	Time timeScale = 1;
+	bool allEvents = false;
+	bool arrivalEvents = false;
+	bool completionEvents = false;
+	std::vector<unsigned int> cores;
+	std::vector<storedJob> jobs;
+	// the event set of the initial state
+	std::set<Time> initialEvents;
+	// in the order of their checkpoints
+	std::vector<snapshot> snapshots;
+
+	bool save(const std::string &fileName) const {
+		std::ofstream out(fileName);
+		if (!out) {
+			return false;
+		}
+		out.precision(std::numeric_limits<Time>::max_digits10);
+		out << "reta-frontiers " << version << " " << scheduler << " " << timeScale << "\n";
+		out << allEvents << " " << arrivalEvents << " " << completionEvents << "\n";
+		writeList(out, cores);
+		out << jobs.size() << "\n";
+		for (const auto &j: jobs) {
+			out << j.task << " " << j.job << " " << j.arrivalMin << " " << j.arrivalMax << " " << j.costMin << " "
+				<< j.costMax << " " << j.deadline << " " << j.priority << " " << j.period << " " << j.cluster << " "
+				<< j.earliestStart << "\n";
+		}
+		writeList(out, initialEvents);
+		out << snapshots.size() << "\n";
+		for (const auto &sn: snapshots) {
+			out << sn.checkpoint << " " << sn.lookahead << " " << sn.numStates << "\n";
+			out << sn.completions.size() << "\n";
+			for (const auto &c: sn.completions) {
+				out << std::get<0>(c) << " " << std::get<1>(c) << " " << std::get<2>(c) << "\n";
+			}
+			out << sn.states.size() << "\n";
+			for (const auto &s: sn.states) {
+				out << s.timeStamp << "\n";
+				writeList(out, s.dispatched);
+				out << s.availability.size();
+				for (const auto &cluster: s.availability) {
+					out << " " << cluster.size();
+					for (const auto &a: cluster) {
+						out << " " << a.min() << " " << a.max();
+					}
+				}
+				out << "\n";
+				writeList(out, s.events);
+			}
+		}
+		return (bool) out;
+	}
+
+	// returns false if the file does not exist or is not a frontier file of this version
+	bool load(const std::string &fileName) {
+		std::ifstream in(fileName);
+		std::string magic;
+		int fileVersion = 0;
+		if (!(in >> magic >> fileVersion) || magic != "reta-frontiers" || fileVersion != version) {
+			return false;
+		}
+		in >> scheduler >> timeScale;
+		in >> allEvents >> arrivalEvents >> completionEvents;
+		readList(in, cores);
+		std::size_t n = 0;
+		in >> n;
+		jobs.resize(n);
+		for (auto &j: jobs) {
+			in >> j.task >> j.job >> j.arrivalMin >> j.arrivalMax >> j.costMin >> j.costMax >> j.deadline
+			   >> j.priority >> j.period >> j.cluster >> j.earliestStart;
+		}
+		readList(in, initialEvents);
+		in >> n;
+		snapshots.resize(n);
+		for (auto &sn: snapshots) {
+			in >> sn.checkpoint >> sn.lookahead >> sn.numStates;
+			in >> n;
+			sn.completions.resize(n);
+			for (auto &c: sn.completions) {
+				in >> std::get<0>(c) >> std::get<1>(c) >> std::get<2>(c);
+			}
+			in >> n;
+			sn.states.resize(n);
+			for (auto &s: sn.states) {
+				in >> s.timeStamp;
+				readList(in, s.dispatched);
+				in >> n;
+				s.availability.resize(n);
+				for (auto &cluster: s.availability) {
+					in >> n;
+					for (std::size_t i = 0; i < n; i++) {
+						Time a, b;
+						in >> a >> b;
+						cluster.emplace_back(a, b);
+					}
+				}
+				readList(in, s.events);
+			}
+		}
+		return (bool) in;
+	}
+
+private:
+	static constexpr int version = 2;
+
+	template<class Container>
+	static void writeList(std::ostream &out, const Container &values) {
+		out << values.size();
+		for (const auto &v: values) {
+			out << " " << v;
+		}
+		out << "\n";
+	}
+
+	template<class T>
+	static void readList(std::istream &in, std::vector<T> &values) {
+		std::size_t n = 0;
+		in >> n;
+		values.resize(n);
+		for (auto &v: values) {
+			in >> v;
+		}
+	}
+
+	template<class T>
+	static void readList(std::istream &in, std::set<T> &values) {
+		std::size_t n = 0;
+		in >> n;
+		for (std::size_t i = 0; i < n && in; i++) {
+			T v;
+			in >> v;
+			values.insert(v);
+		}
+	}
+};
+
+#endif
@@ -35,6 +35,8 @@ public:
             : start(orig.start), end(orig.end) {
     }
 
+    Interval<Time> &operator=(const Interval<Time> &other) = default;
+
     const Time from() const {
         return start;
     }
@@ -207,6 +209,20 @@ public:
         return buckets[i];
     }
 
+    std::size_t numBuckets() const {
+        return num_buckets;
+    }
+
+    // drop the contents of all buckets, only the geometry (bucket_of, bucketStart) remains usable
+    void releaseBuckets() {
+        buckets = std::make_unique<Bucket[]>(num_buckets);
+    }
+
+    // first point of the i-th bucket
+    T bucketStart(std::size_t i) const {
+        return range.from() + width * static_cast<T>(i);
+    }
+
 };
 
 #endif
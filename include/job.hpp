@@ -22,6 +22,8 @@ struct jobID {
         this->task = other.task;
     }
 
+    jobID &operator=(const jobID &other) = default;
+
     bool operator==(const jobID &other) const {
         return this->task == other.task && this->job == other.job;
     }
@@ -55,7 +57,6 @@ class job {
     typedef Time Priority; // For fixed priority scheduling policies
 
 private:
-    std::string taskName;
     std::string name;
     Interval<Time> arrival;
     Interval<Time> cost;
@@ -96,8 +97,6 @@ public:
                                                                                            assignedProcessorSet(
                                                                                                    assignedProcessorSet),
                                                                                                    taskPeriod(taskPeriod){
-        // cut the string before , and assign it to task name
-        taskName = name.substr(0, name.find(","));
         computeHash();
     }
 
@@ -109,8 +108,6 @@ public:
                                                                                            assignedProcessorSet(
                                                                                                    assignedProcessorSet),
                                                                                                    taskPeriod(taskPeriod){
-        // cut the string before , and assign it to task name
-        taskName = name.substr(0, name.find(","));
         computeHash();
     }
 //    job(unsigned long tid, unsigned long sid, Interval<Time> arrival, Interval<Time> cost, Time deadline)
@@ -174,8 +171,9 @@ public:
         return assignedProcessorSet;
     }
 
+    // the task name is the part of the job name before ','
     std::string getTaskName() const {
-        return taskName;
+        return name.substr(0, name.find(","));
     }
 
     bool exceedsDeadline(Time t) const {
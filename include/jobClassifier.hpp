@@ -0,0 +1,227 @@
+#ifndef JOB_CLASSIFIER_HPP
+#define JOB_CLASSIFIER_HPP
+
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+#include "job.hpp"
+#include "state.hpp"
+#include "interval.hpp"
+
+// batch classification of the jobs of one lookup-table bucket
+// the job parameters are stored as structure of arrays per bucket, so that the comparisons
+// against the time stamp are branch-free loops over contiguous arrays that the compiler vectorizes
+// the processor availability is hoisted out of the loop: it only depends on the cluster of the job
+template<class Time>
+class jobClassifier {
+public:
+	// classification flags of a job
+	enum : std::uint8_t {
+		DISPATCHED = 1,
+		POSSIBLY_RELEASED = 2,
+		CERTAINLY_RELEASED = 4,
+		POSSIBLY_FREE = 8,
+		CERTAINLY_FREE = 16,
+		MISSES_DEADLINE = 32
+	};
+
+	struct bucket {
+		std::vector<jobID> id;
+		std::vector<std::size_t> index;
+		std::vector<unsigned int> cluster;
+		std::vector<Time> arrivalMin;
+		std::vector<Time> arrivalMax;
+		// the job misses its deadline if it starts after this time
+		std::vector<Time> latestStart;
+		std::vector<Time> deadline;
+
+		std::size_t size() const {
+			return id.size();
+		}
+	};
+
+	// the flags of all jobs of a bucket at a time stamp (one byte per job, in bucket order)
+	struct classification {
+		std::size_t bucket = 0;
+		Time timeStamp = 0;
+		std::vector<std::uint8_t> flags;
+	};
+
+	jobClassifier() = default;
+
+	// index the jobs of each bucket of the given lookup table (by their index in the workload)
+	// the jobs of each bucket are stored in the given order (stable, so the lookup-table order
+	// is kept for jobs that compare equal); the arrays of a bucket are only built when the bucket is first
+	// classified, so that only the buckets around the frontier of the exploration are resident
+	template<class LookupTable, class Order>
+	jobClassifier(const std::vector<job<Time>> &workload, const LookupTable &lut, std::size_t numBuckets,
+				  std::size_t numClusters, Order order)
+			: workload(workload.data()), members(numBuckets), buckets(numBuckets), built(numBuckets, 0),
+			  possiblyFree(numClusters), certainlyFree(numClusters) {
+		for (std::size_t b = 0; b < numBuckets; b++) {
+			const auto &jobs = lut.bucket(b);
+			std::vector<std::size_t> perm(jobs.size());
+			std::iota(perm.begin(), perm.end(), 0);
+			std::stable_sort(perm.begin(), perm.end(), [&](std::size_t x, std::size_t y) {
+				return order(jobs[x].get(), jobs[y].get());
+			});
+			members[b].reserve(perm.size());
+			for (auto p: perm) {
+				members[b].push_back((std::size_t) (&jobs[p].get() - workload.data()));
+			}
+		}
+	}
+
+	// free the arrays of all buckets before the given one
+	// the exploration visits the states in the order of their time stamps, so the buckets behind
+	// the smallest time stamp of the explorable states are not classified again (if one is, e.g. after
+	// resuming from a frontier, it is built again and freed by the next call)
+	void retireBefore(std::size_t b) {
+		for (; lowestBuilt < std::min(b, buckets.size()); lowestBuilt++) {
+			if (built[lowestBuilt]) {
+				buckets[lowestBuilt] = bucket();
+				built[lowestBuilt] = 0;
+			}
+		}
+	}
+
+	const bucket &lookup(std::size_t b) {
+		return at(b);
+	}
+
+	// classify all jobs of a bucket at the time stamp of the given state
+	void classify(std::size_t b, const state<Time> &s, classification &result) {
+		classify(b, s, s.getTimeStamp(), result);
+	}
+
+	// classify all jobs of a bucket at a later time, as if the given state advanced to it
+	void classify(std::size_t b, const state<Time> &s, Time ts, classification &result) {
+		const bucket &bk = at(b);
+		const std::size_t n = bk.size();
+		result.bucket = b;
+		result.timeStamp = ts;
+		result.flags.resize(n);
+
+		// availability of the first core of each cluster
+		for (std::size_t c = 0; c < possiblyFree.size(); c++) {
+			auto availability = s.getProcessorAvailability(c, 1);
+			possiblyFree[c] = availability.min() <= ts ? POSSIBLY_FREE : 0;
+			certainlyFree[c] = availability.max() <= ts ? CERTAINLY_FREE : 0;
+		}
+
+		// release and deadline checks (vectorized compares)
+		const Time *aMin = bk.arrivalMin.data();
+		const Time *aMax = bk.arrivalMax.data();
+		const Time *ls = bk.latestStart.data();
+		std::uint8_t *f = result.flags.data();
+		for (std::size_t i = 0; i < n; i++) {
+			f[i] = (std::uint8_t) ((ts >= aMin[i] ? POSSIBLY_RELEASED : 0)
+								   | (ts >= aMax[i] ? CERTAINLY_RELEASED : 0)
+								   | (ts > ls[i] ? MISSES_DEADLINE : 0));
+		}
+
+		// cluster availability and dispatched jobs (table lookups)
+		for (std::size_t i = 0; i < n; i++) {
+			f[i] |= possiblyFree[bk.cluster[i]] | certainlyFree[bk.cluster[i]]
+					| (s.isDispatched(bk.index[i]) ? DISPATCHED : 0);
+		}
+	}
+
+	// derive the classification of a state that dispatched one job from the classification of its parent
+	// the time stamp (and thus the bucket and the release flags) is the same, only the dispatched job
+	// and the availability of its cluster change
+	void dispatched(const classification &parent, const state<Time> &child, std::size_t jobIndex,
+					unsigned int cluster, classification &result) {
+		const bucket &bk = at(parent.bucket);
+		const Time ts = parent.timeStamp;
+		const std::size_t n = bk.size();
+		result.bucket = parent.bucket;
+		result.timeStamp = ts;
+		result.flags = parent.flags;
+
+		auto availability = child.getProcessorAvailability(cluster, 1);
+		const std::uint8_t free = (availability.min() <= ts ? POSSIBLY_FREE : 0)
+								  | (availability.max() <= ts ? CERTAINLY_FREE : 0);
+		const std::uint8_t keep = (std::uint8_t) ~(POSSIBLY_FREE | CERTAINLY_FREE);
+		std::uint8_t *f = result.flags.data();
+		for (std::size_t i = 0; i < n; i++) {
+			f[i] = bk.cluster[i] == cluster ? (std::uint8_t) ((f[i] & keep) | free) : f[i];
+			f[i] |= bk.index[i] == jobIndex ? DISPATCHED : 0;
+		}
+	}
+
+	// update the availability flags of a classification after the availability of its state has changed
+	// (e.g., the state was merged with another state)
+	void availabilityChanged(const state<Time> &s, classification &result) {
+		const bucket &bk = at(result.bucket);
+		const Time ts = result.timeStamp;
+		const std::size_t n = bk.size();
+		for (std::size_t c = 0; c < possiblyFree.size(); c++) {
+			auto availability = s.getProcessorAvailability(c, 1);
+			possiblyFree[c] = availability.min() <= ts ? POSSIBLY_FREE : 0;
+			certainlyFree[c] = availability.max() <= ts ? CERTAINLY_FREE : 0;
+		}
+		const std::uint8_t keep = (std::uint8_t) ~(POSSIBLY_FREE | CERTAINLY_FREE);
+		std::uint8_t *f = result.flags.data();
+		for (std::size_t i = 0; i < n; i++) {
+			f[i] = (std::uint8_t) ((f[i] & keep) | possiblyFree[bk.cluster[i]] | certainlyFree[bk.cluster[i]]);
+		}
+	}
+
+	// whether a job of the bucket that is assigned to the given cluster may be pending at the given time
+	// (possibly released and not past its deadline) in a state that dispatched the given job
+	bool mayBePending(std::size_t b, unsigned int cluster, Time t, const state<Time> &s,
+					  std::size_t dispatchedJob) {
+		const bucket &bk = at(b);
+		for (std::size_t i = 0; i < bk.size(); i++) {
+			if (bk.cluster[i] == cluster && bk.arrivalMin[i] <= t && t <= bk.deadline[i]
+				&& bk.index[i] != dispatchedJob && !s.isDispatched(bk.index[i])) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+private:
+	const job<Time> *workload = nullptr;
+	// the jobs of each bucket in the order of the policy
+	std::vector<std::vector<std::size_t>> members;
+	std::vector<bucket> buckets;
+	std::vector<std::uint8_t> built;
+	// no bucket before this one is built
+	std::size_t lowestBuilt = 0;
+	std::vector<std::uint8_t> possiblyFree;
+	std::vector<std::uint8_t> certainlyFree;
+
+	// the arrays of a bucket, built from its jobs on first use
+	const bucket &at(std::size_t b) {
+		if (!built[b]) {
+			bucket &bk = buckets[b];
+			const std::size_t n = members[b].size();
+			bk.id.reserve(n);
+			bk.index.reserve(n);
+			bk.cluster.reserve(n);
+			bk.arrivalMin.reserve(n);
+			bk.arrivalMax.reserve(n);
+			bk.latestStart.reserve(n);
+			bk.deadline.reserve(n);
+			for (auto i: members[b]) {
+				const job<Time> &j = workload[i];
+				bk.id.push_back(j.getID());
+				bk.index.push_back(i);
+				bk.cluster.push_back(j.getAssignedProcessorSet());
+				bk.arrivalMin.push_back(j.getArrival().min());
+				bk.arrivalMax.push_back(j.getArrival().max());
+				bk.latestStart.push_back(j.getDeadline() + timeModel::constants<Time>::deadlineMissTolerance()
+										 - j.getCost().max());
+				bk.deadline.push_back(j.getDeadline());
+			}
+			built[b] = 1;
+			lowestBuilt = std::min(lowestBuilt, b);
+		}
+		return buckets[b];
+	}
+};
+
+#endif
@@ -17,7 +17,7 @@ public:
 
     scheduler(segmentMap segments) : segmentsByID(segments) { }
 
-    std::optional<jobID> callScheduler(queue<Time> &readyQueue, const std::unordered_map<std::string, unsigned int> &availableResources, Time currentTime) {
+    std::optional<jobID> callScheduler(queue<Time> &readyQueue, const std::vector<unsigned int> &availableResources, Time currentTime) {
         // if the queue is empty, return an empty optional
         if (readyQueue.empty()) {
             return std::nullopt;
@@ -29,6 +29,20 @@ public:
         return readyQueue.front();
 
     }
+
+    // policy traits (generated by the DSL parser)
+    static constexpr bool readsCurrentTime = false;
+    static constexpr bool readsAvailableResources = false;
+    static constexpr bool sortThenPick = true;
+    static constexpr sortKey pickKey = sortKey::deadline;
+    static constexpr bool pickFront = true;
+    static constexpr bool timeScaleInvariant = true;
+    static constexpr bool clusterIndependent = true;
+    static constexpr bool jobLevelFixedPriority = true;
+    static constexpr bool readsTaskTable = false;
+    static constexpr bool readsArrival = false;
+    static constexpr bool readsCost = false;
+    static constexpr unsigned long long fingerprint = 0xe1d96f0113456fb1ULL;
 };
 
 #endif
\ No newline at end of file
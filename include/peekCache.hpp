@@ -0,0 +1,114 @@
+#ifndef PEEK_CACHE_HPP
+#define PEEK_CACHE_HPP
+
+#include <vector>
+#include <functional>
+#include "state.hpp"
+#include "indexSet.hpp"
+
+// bounded cache of peeked time transitions
+// key: (dispatched jobs, processor availability, event set hash, time stamp) of the peeked state,
+// value: the next significant event time found by peeking from it
+// the cache is direct-mapped like the decision cache, a colliding key overwrites its slot
+template<class Time>
+class peekCache {
+public:
+	typedef std::vector<std::vector<Interval<Time>>> availabilityVector;
+
+	static constexpr std::size_t defaultCapacity = 1 << 12;
+
+	explicit peekCache(std::size_t capacity = defaultCapacity) : slots(capacity) {
+	}
+
+	static std::size_t hashOf(const state<Time> &s) {
+		std::hash<Time> ht;
+		std::size_t hash = ht(s.getTimeStamp()) ^ s.getLookupKey();
+		hash = (hash * 0x100000001b3UL) ^ s.getEventSetHash();
+		for (const auto &cluster: s.getProcessorAvailability()) {
+			for (const auto &a: cluster) {
+				hash = (hash * 0x100000001b3UL) ^ ht(a.min());
+				hash = (hash * 0x100000001b3UL) ^ ht(a.max());
+			}
+		}
+		return hash;
+	}
+
+	// look up the peeked event time of a state, returns true on a hit
+	// the event sets are only compared by hash, a hit is verified by replaying the events the peek moved to
+	// (nextEvent(s, t): the event a peek of s at time t moves to next), the peek reads no other events
+	template<class NextEvent>
+	bool lookup(std::size_t hash, const state<Time> &s, Time &result, NextEvent nextEvent) {
+		const slot &sl = slots[hash % slots.size()];
+		if (sl.valid && sl.hash == hash && sl.timeStamp == s.getTimeStamp()
+			&& sl.eventSetHash == s.getEventSetHash() && sl.dispatched == s.getDispatchedSet()
+			&& sl.availability == s.getProcessorAvailability() && replays(sl.steps, s, nextEvent)) {
+			result = sl.value;
+			hits++;
+			return true;
+		}
+		misses++;
+		return false;
+	}
+
+	// steps: the events the peek moved to (the last is infinity if it ran out of events)
+	void store(std::size_t hash, const state<Time> &s, Time value, const std::vector<Time> &steps) {
+		slot &sl = slots[hash % slots.size()];
+		sl.hash = hash;
+		sl.timeStamp = s.getTimeStamp();
+		sl.eventSetHash = s.getEventSetHash();
+		sl.dispatched = s.getDispatchedSet();
+		sl.availability = s.getProcessorAvailability();
+		sl.steps = steps;
+		sl.value = value;
+		sl.valid = true;
+	}
+
+	unsigned long getHits() const {
+		return hits;
+	}
+
+	unsigned long getMisses() const {
+		return misses;
+	}
+
+	// add the counters of another cache (e.g., of the analysis of another cluster)
+	void absorbCounts(const peekCache &other) {
+		hits += other.hits;
+		misses += other.misses;
+	}
+
+	double getHitRate() const {
+		unsigned long total = hits + misses;
+		return total == 0 ? 0.0 : (double) hits / (double) total;
+	}
+
+private:
+	struct slot {
+		bool valid = false;
+		std::size_t hash = 0;
+		Time timeStamp = 0;
+		std::size_t eventSetHash = 0;
+		indexSet dispatched;
+		availabilityVector availability;
+		std::vector<Time> steps;
+		Time value = 0;
+	};
+
+	template<class NextEvent>
+	static bool replays(const std::vector<Time> &steps, const state<Time> &s, NextEvent nextEvent) {
+		Time t = s.getTimeStamp();
+		for (auto step: steps) {
+			if (nextEvent(s, t) != step) {
+				return false;
+			}
+			t = step;
+		}
+		return true;
+	}
+
+	std::vector<slot> slots;
+	unsigned long hits = 0;
+	unsigned long misses = 0;
+};
+
+#endif
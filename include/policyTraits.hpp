@@ -0,0 +1,121 @@
+#ifndef POLICY_TRAITS_HPP
+#define POLICY_TRAITS_HPP
+
+#include <type_traits>
+
+// compile-time properties of the scheduling policy
+// the DSL parser emits them as static members of the generated scheduler class;
+// a scheduler imported with import_file() may omit them, then the conservative
+// defaults below are used
+namespace policy {
+
+	// the policy reads the current time (current_time(), laxity, next_deadline())
+	template<class S, class = void>
+	struct readsCurrentTime : std::true_type {
+	};
+
+	template<class S>
+	struct readsCurrentTime<S, std::void_t<decltype(S::readsCurrentTime)>>
+			: std::bool_constant<S::readsCurrentTime> {
+	};
+
+	// the policy reads the number of available cores (available_instance())
+	template<class S, class = void>
+	struct readsAvailableResources : std::true_type {
+	};
+
+	template<class S>
+	struct readsAvailableResources<S, std::void_t<decltype(S::readsAvailableResources)>>
+			: std::bool_constant<S::readsAvailableResources> {
+	};
+
+	// the policy sorts the ready queue by a static key and returns its front or back
+	// (the scheduler then also defines pickKey and pickFront)
+	template<class S, class = void>
+	struct sortThenPick : std::false_type {
+	};
+
+	template<class S>
+	struct sortThenPick<S, std::void_t<decltype(S::sortThenPick)>>
+			: std::bool_constant<S::sortThenPick> {
+	};
+
+	// the policy makes the same decisions if all time parameters are divided by a common factor
+	// (it does not compare time values with constants)
+	template<class S, class = void>
+	struct timeScaleInvariant : std::false_type {
+	};
+
+	template<class S>
+	struct timeScaleInvariant<S, std::void_t<decltype(S::timeScaleInvariant)>>
+			: std::bool_constant<S::timeScaleInvariant> {
+	};
+
+	// job-level fixed-priority and work-conserving: the policy orders the jobs by a key that does not change
+	// over time and always selects the first job of a non-empty ready queue (sort-then-pick policies)
+	template<class S, class = void>
+	struct jobLevelFixedPriority : std::false_type {
+	};
+
+	template<class S>
+	struct jobLevelFixedPriority<S, std::void_t<decltype(S::jobLevelFixedPriority)>>
+			: std::bool_constant<S::jobLevelFixedPriority> {
+	};
+
+	// the decision for the jobs of one cluster does not depend on the jobs and the cores of other clusters
+	// (the clusters can then be analyzed separately)
+	template<class S, class = void>
+	struct clusterIndependent : std::false_type {
+	};
+
+	template<class S>
+	struct clusterIndependent<S, std::void_t<decltype(S::clusterIndependent)>>
+			: std::bool_constant<S::clusterIndependent> {
+	};
+
+	// the policy reads the arrival intervals of the jobs (sorts by arrival_min or arrival_max)
+	template<class S, class = void>
+	struct readsArrival : std::true_type {
+	};
+
+	template<class S>
+	struct readsArrival<S, std::void_t<decltype(S::readsArrival)>>
+			: std::bool_constant<S::readsArrival> {
+	};
+
+	// the policy reads the execution-time intervals of the jobs (sorts by cost_min, cost_max or laxity, or reads
+	// the WCET of a job or of a task, which next_deadline() also does)
+	template<class S, class = void>
+	struct readsCost : std::true_type {
+	};
+
+	template<class S>
+	struct readsCost<S, std::void_t<decltype(S::readsCost)>>
+			: std::bool_constant<S::readsCost> {
+	};
+
+	// the policy reads the task table (next_deadline(), wcet()), which the scheduler builds from the jobs it is
+	// given, so it needs the jobs of every task
+	template<class S, class = void>
+	struct readsTaskTable : std::true_type {
+	};
+
+	template<class S>
+	struct readsTaskTable<S, std::void_t<decltype(S::readsTaskTable)>>
+			: std::bool_constant<S::readsTaskTable> {
+	};
+
+	// a hash of the generated policy and its traits, which tells the frontiers stored by the analysis of another
+	// policy apart (0 if unknown)
+	template<class S, class = void>
+	struct fingerprint : std::integral_constant<unsigned long long, 0> {
+	};
+
+	template<class S>
+	struct fingerprint<S, std::void_t<decltype(S::fingerprint)>>
+			: std::integral_constant<unsigned long long, S::fingerprint> {
+	};
+
+}
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef PREDECESSOR_LOG_HPP
+#define PREDECESSOR_LOG_HPP
+
+#include <cstdio>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+// disk-backed log of the transition that created each state
+// the states are numbered in the order of their creation, so the record of a state is found by its ID
+// (fixed-size records in one temporary file, the transition labels in another one) and the states need
+// no back-pointer of their own; a path from the initial state is rebuilt by following the parents
+template<class Time>
+class predecessorLog {
+public:
+	static constexpr std::uint64_t noParent = ~(std::uint64_t) 0;
+
+	struct step {
+		std::uint64_t state;
+		Time timeStamp;
+		// the dispatched jobs, or empty for a time transition
+		std::string dispatched;
+	};
+
+	predecessorLog() = default;
+
+	// open the temporary files (they are removed when the log is destroyed)
+	bool open() {
+		records.reset(std::tmpfile(), closeFile);
+		labels.reset(std::tmpfile(), closeFile);
+		numRecords = 0;
+		labelsSize = 0;
+		return records && labels;
+	}
+
+	bool isOpen() const {
+		return records != nullptr;
+	}
+
+	// the record of the next state (the states have to be appended in the order of their IDs)
+	void append(std::uint64_t state, std::uint64_t parent, Time timeStamp, const std::string &dispatched) {
+		if (!records || state != numRecords) {
+			return;
+		}
+		record r{parent, timeStamp, labelsSize, (std::uint32_t) dispatched.size()};
+		std::fseek(records.get(), 0, SEEK_END);
+		std::fwrite(&r, sizeof(record), 1, records.get());
+		std::fseek(labels.get(), 0, SEEK_END);
+		std::fwrite(dispatched.data(), 1, dispatched.size(), labels.get());
+		labelsSize += dispatched.size();
+		numRecords++;
+	}
+
+	// the transitions from the initial state to the given state
+	std::vector<step> path(std::uint64_t state) const {
+		std::vector<step> steps;
+		while (state < numRecords) {
+			record r;
+			std::fseek(records.get(), (long) (state * sizeof(record)), SEEK_SET);
+			if (std::fread(&r, sizeof(record), 1, records.get()) != 1) {
+				break;
+			}
+			std::string dispatched(r.labelLength, ' ');
+			std::fseek(labels.get(), (long) r.labelOffset, SEEK_SET);
+			if (r.labelLength > 0 && std::fread(&dispatched[0], 1, r.labelLength, labels.get()) != r.labelLength) {
+				break;
+			}
+			steps.push_back({state, r.timeStamp, dispatched});
+			state = r.parent;
+		}
+		std::reverse(steps.begin(), steps.end());
+		return steps;
+	}
+
+private:
+	struct record {
+		std::uint64_t parent;
+		Time timeStamp;
+		std::uint64_t labelOffset;
+		std::uint32_t labelLength;
+	};
+
+	static void closeFile(std::FILE *f) {
+		if (f != nullptr) {
+			std::fclose(f);
+		}
+	}
+
+	std::shared_ptr<std::FILE> records;
+	std::shared_ptr<std::FILE> labels;
+	std::uint64_t numRecords = 0;
+	std::uint64_t labelsSize = 0;
+};
+
+#endif
@@ -26,12 +26,20 @@ struct queue {
             segmentsByID(segmentsByID), elements(elements) {}
 
 
+    // ready queues are often built in key order already, then sorting is a linear check
+    template<class Compare>
+    void sortBy(Compare less) {
+        if (!std::is_sorted(elements.begin(), elements.end(), less)) {
+            std::sort(elements.begin(), elements.end(), less);
+        }
+    }
+
     void sort(sortKey key, Time currentTime = 0) {
         switch (key) {
             case arrival_min:
-                std::sort(elements.begin(), elements.end(), [this](jobID a, jobID b) {
-                    auto a_segment = segmentsByID.find(a)->second;
-                    auto b_segment = segmentsByID.find(b)->second;
+                sortBy([this](jobID a, jobID b) {
+                    const auto &a_segment = segmentsByID.find(a)->second;
+                    const auto &b_segment = segmentsByID.find(b)->second;
 
                     return a_segment.getArrival().min() < b_segment.getArrival().min()
                            ||
@@ -43,9 +51,9 @@ struct queue {
                 break;
 
             case arrival_max:
-                std::sort(elements.begin(), elements.end(), [this](jobID a, jobID b) {
-                    auto a_segment = segmentsByID.find(a)->second;
-                    auto b_segment = segmentsByID.find(b)->second;
+                sortBy([this](jobID a, jobID b) {
+                    const auto &a_segment = segmentsByID.find(a)->second;
+                    const auto &b_segment = segmentsByID.find(b)->second;
 
                     return a_segment.getArrival().max() < b_segment.getArrival().max()
                            || (a_segment.getArrival().max() == b_segment.getArrival().max() && a.task < b.task)
@@ -55,9 +63,9 @@ struct queue {
                 break;
 
             case cost_min:
-                std::sort(elements.begin(), elements.end(), [this](jobID a, jobID b) {
-                    auto a_segment = segmentsByID.find(a)->second;
-                    auto b_segment = segmentsByID.find(b)->second;
+                sortBy([this](jobID a, jobID b) {
+                    const auto &a_segment = segmentsByID.find(a)->second;
+                    const auto &b_segment = segmentsByID.find(b)->second;
 
                     return a_segment.getCost().min() < b_segment.getCost().min()
                            || (a_segment.getCost().min() == b_segment.getCost().min() && a.task < b.task)
@@ -67,9 +75,9 @@ struct queue {
                 break;
 
             case cost_max:
-                std::sort(elements.begin(), elements.end(), [this](jobID a, jobID b) {
-                    auto a_segment = segmentsByID.find(a)->second;
-                    auto b_segment = segmentsByID.find(b)->second;
+                sortBy([this](jobID a, jobID b) {
+                    const auto &a_segment = segmentsByID.find(a)->second;
+                    const auto &b_segment = segmentsByID.find(b)->second;
 
                     return a_segment.getCost().max() < b_segment.getCost().max()
                            || (a_segment.getCost().max() == b_segment.getCost().max() && a.task < b.task)
@@ -79,9 +87,9 @@ struct queue {
                 break;
 
             case deadline:
-                std::sort(elements.begin(), elements.end(), [this](jobID a, jobID b) {
-                    auto a_segment = segmentsByID.find(a)->second;
-                    auto b_segment = segmentsByID.find(b)->second;
+                sortBy([this](jobID a, jobID b) {
+                    const auto &a_segment = segmentsByID.find(a)->second;
+                    const auto &b_segment = segmentsByID.find(b)->second;
 
                     return a_segment.getDeadline() < b_segment.getDeadline()
                            || (a_segment.getDeadline() == b_segment.getDeadline() && a.task < b.task)
@@ -91,9 +99,9 @@ struct queue {
                 break;
 
             case priority:
-                std::sort(elements.begin(), elements.end(), [this](jobID a, jobID b) {
-                    auto a_segment = segmentsByID.find(a)->second;
-                    auto b_segment = segmentsByID.find(b)->second;
+                sortBy([this](jobID a, jobID b) {
+                    const auto &a_segment = segmentsByID.find(a)->second;
+                    const auto &b_segment = segmentsByID.find(b)->second;
 
                     return a_segment.getPriority() < b_segment.getPriority()
                            || (a_segment.getPriority() == b_segment.getPriority() && a.task < b.task)
@@ -103,9 +111,9 @@ struct queue {
                 break;
 
             case period:
-                std::sort(elements.begin(), elements.end(), [this](jobID a, jobID b) {
-                    auto a_segment = segmentsByID.find(a)->second;
-                    auto b_segment = segmentsByID.find(b)->second;
+                sortBy([this](jobID a, jobID b) {
+                    const auto &a_segment = segmentsByID.find(a)->second;
+                    const auto &b_segment = segmentsByID.find(b)->second;
 
                     return a_segment.getTaskPeriod() < b_segment.getTaskPeriod()
                            || (a_segment.getTaskPeriod() == b_segment.getTaskPeriod() && a.task < b.task)
@@ -114,9 +122,9 @@ struct queue {
                 });
                 break;
 			case laxity:
-				std::sort(elements.begin(), elements.end(), [this, currentTime](jobID a, jobID b) {
-					auto a_segment = segmentsByID.find(a)->second;
-					auto b_segment = segmentsByID.find(b)->second;
+				sortBy([this, currentTime](jobID a, jobID b) {
+					const auto &a_segment = segmentsByID.find(a)->second;
+					const auto &b_segment = segmentsByID.find(b)->second;
 
 					auto a_laxity = a_segment.getDeadline() - currentTime - a_segment.getCost().max();
 					auto b_laxity = b_segment.getDeadline() - currentTime - b_segment.getCost().max();
@@ -0,0 +1,52 @@
+#ifndef RESOURCE_COMBINATIONS_HPP
+#define RESOURCE_COMBINATIONS_HPP
+
+#include <vector>
+
+// mixed-radix iterator over all combinations of the number of available resources
+// digit i runs from the number of certainly available cores of cluster i
+// to the number of possibly available cores of cluster i
+// buffers are sized once per cluster count and reused, so iterating does not allocate
+class resourceCombinations {
+private:
+	std::vector<unsigned int> low;
+	std::vector<unsigned int> high;
+	std::vector<unsigned int> current;
+
+public:
+	resourceCombinations() = default;
+
+	explicit resourceCombinations(std::size_t numClusters)
+			: low(numClusters, 0), high(numClusters, 0), current(numClusters, 0) {
+	}
+
+	// set the range of digit i (inclusive bounds)
+	void setRange(std::size_t i, unsigned int certainlyAvailable, unsigned int possiblyAvailable) {
+		low[i] = certainlyAvailable;
+		high[i] = possiblyAvailable;
+	}
+
+	// move to the first combination
+	void begin() {
+		std::copy(low.begin(), low.end(), current.begin());
+	}
+
+	// move to the next combination, returns false after the last one
+	bool next() {
+		for (std::size_t i = 0; i < current.size(); i++) {
+			if (current[i] < high[i]) {
+				current[i]++;
+				return true;
+			}
+			current[i] = low[i];
+		}
+		return false;
+	}
+
+	// number of available cores indexed by cluster ID
+	const std::vector<unsigned int> &get() const {
+		return current;
+	}
+};
+
+#endif
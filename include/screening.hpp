@@ -0,0 +1,240 @@
+#ifndef SCREENING_HPP
+#define SCREENING_HPP
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+#include "task.hpp"
+#include "processor.hpp"
+#include "queue.hpp"
+#include "policyTraits.hpp"
+#include "models/events.hpp"
+#include "models/scheduler.hpp"
+
+// cheap analytical tests that decide the schedulability of a periodic task set before the exploration
+// the jobs run non-preemptively and each cluster is analyzed on its own; a test either proves that a job
+// misses its deadline (for any policy) or that no job does (for the policy class of the scheduler),
+// otherwise the task set is left to the exploration
+namespace screening {
+
+	struct result {
+		bool conclusive = false;
+		bool schedulable = false;
+		std::string method;
+	};
+
+	template<class Time>
+	Time floorDiv(Time a, Time b) {
+		if constexpr (std::is_floating_point<Time>::value) {
+			return std::floor(a / b);
+		} else {
+			return a >= 0 ? a / b : -((-a + b - 1) / b);
+		}
+	}
+
+	// key of a task under a task-level fixed-priority policy (false if the key is not fixed per task)
+	template<class Time>
+	bool taskKey(sortKey key, const task<Time> &t, Time &result) {
+		switch (key) {
+			case priority:
+				result = t.getPriority();
+				return true;
+			case period:
+				result = t.getPeriod();
+				return true;
+			case cost_min:
+				result = t.getMinCost();
+				return true;
+			case cost_max:
+				result = t.getMaxCost();
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	// a job released at the end of its jitter with its WCET, or the WCET of all jobs of the hyperperiod,
+	// does not fit before the deadline
+	template<class Time>
+	bool exceedsCapacity(const std::vector<task<Time>> &tasks, unsigned int cores, Time hyperperiod) {
+		Time work = 0;
+		Time window = 0;
+		for (const auto &t: tasks) {
+			if (t.getJitter() + t.getMaxCost() > t.getDeadline()) {
+				return true;
+			}
+			work += floorDiv<Time>(hyperperiod, t.getPeriod()) * t.getMaxCost();
+			window = std::max(window, hyperperiod - t.getPeriod() + t.getDeadline());
+		}
+		return work > window * cores;
+	}
+
+	// every task has a core of its own: a job starts at its release and finishes before the next release
+	template<class Time>
+	bool dedicatedCores(const std::vector<task<Time>> &tasks, unsigned int cores) {
+		return tasks.size() <= cores && std::all_of(tasks.begin(), tasks.end(), [](const task<Time> &t) {
+			return t.getJitter() + t.getMaxCost() <= t.getDeadline() && t.getDeadline() <= t.getPeriod();
+		});
+	}
+
+	// response-time analysis of non-preemptive fixed-priority scheduling on one core
+	// (sufficient test of Davis et al., the previous job of the task may block like a lower-priority job;
+	// tasks with equal keys interfere with each other, a response time beyond the period is inconclusive)
+	template<class Time>
+	bool fixedPriorityRTA(const std::vector<task<Time>> &tasks, sortKey key, bool pickFront) {
+		std::vector<Time> keys(tasks.size());
+		for (std::size_t i = 0; i < tasks.size(); i++) {
+			taskKey(key, tasks[i], keys[i]);
+		}
+		for (std::size_t i = 0; i < tasks.size(); i++) {
+			const task<Time> &ti = tasks[i];
+			Time bound = std::min(ti.getDeadline(), ti.getPeriod());
+			Time blocking = ti.getMaxCost();
+			std::vector<std::size_t> interfering;
+			for (std::size_t j = 0; j < tasks.size(); j++) {
+				if (j == i) {
+					continue;
+				}
+				bool lower = pickFront ? keys[j] > keys[i] : keys[j] < keys[i];
+				if (lower) {
+					blocking = std::max(blocking, tasks[j].getMaxCost());
+				} else {
+					interfering.push_back(j);
+				}
+			}
+
+			// queuing delay: fixed point of w = B + sum over interfering tasks of (floor((w + J) / T) + 1) * C
+			Time w = blocking;
+			while (true) {
+				if (ti.getJitter() + w + ti.getMaxCost() > bound) {
+					return false;
+				}
+				Time next = blocking;
+				for (auto j: interfering) {
+					const task<Time> &tj = tasks[j];
+					next += (floorDiv<Time>(w + tj.getJitter(), tj.getPeriod()) + 1) * tj.getMaxCost();
+				}
+				if (next == w) {
+					break;
+				}
+				w = next;
+			}
+		}
+		return true;
+	}
+
+	// processor-demand test of non-preemptive EDF on one core (George et al., with release jitter):
+	// at each step t of the demand bound function, the demand of the jobs with both release and deadline
+	// in a window of length t plus the longest job with a larger relative deadline fits in the window
+	template<class Time>
+	bool edfDemand(const std::vector<task<Time>> &tasks, Time hyperperiod) {
+		double utilization = 0;
+		Time horizon = 0;
+		for (const auto &t: tasks) {
+			if (t.getDeadline() < t.getJitter()) {
+				return false;
+			}
+			utilization += (double) t.getMaxCost() / (double) t.getPeriod();
+			horizon = std::max(horizon, hyperperiod + t.getDeadline() - t.getJitter());
+		}
+		if (utilization > 1) {
+			return false;
+		}
+
+		std::vector<Time> steps;
+		for (const auto &t: tasks) {
+			for (Time s = t.getDeadline() - t.getJitter(); s <= horizon; s += t.getPeriod()) {
+				steps.push_back(s);
+			}
+		}
+		std::sort(steps.begin(), steps.end());
+		steps.erase(std::unique(steps.begin(), steps.end()), steps.end());
+
+		for (auto s: steps) {
+			Time demand = 0;
+			for (const auto &t: tasks) {
+				Time jobs = floorDiv<Time>(s + t.getJitter() - t.getDeadline(), t.getPeriod()) + 1;
+				demand += std::max(Time(0), jobs) * t.getMaxCost();
+			}
+			Time blocking = 0;
+			for (const auto &t: tasks) {
+				if (t.getDeadline() > s) {
+					blocking = std::max(blocking, t.getMaxCost());
+				}
+			}
+			if (demand + blocking > s) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// screen the task set with the tests that apply to the policy
+	// the tests only cover periodic tasks: explicit segments are left to the exploration
+	template<class Time>
+	result screen(const std::vector<task<Time>> &tasks, const std::vector<job<Time>> &segments,
+				  const std::vector<processor> &processors, const events<Time> &systemEvents, Time hyperperiod) {
+		result r;
+		if (!segments.empty() || tasks.empty()) {
+			return r;
+		}
+
+		std::vector<std::vector<task<Time>>> clusters(processors.size());
+		for (const auto &t: tasks) {
+			clusters[t.getAssignedProcessorSet()].push_back(t);
+		}
+
+		// a job misses its deadline under any policy
+		for (std::size_t c = 0; c < clusters.size(); c++) {
+			if (!clusters[c].empty() && exceedsCapacity(clusters[c], processors[c].getNumCores(), hyperperiod)) {
+				r.conclusive = true;
+				r.method = "Demand";
+				return r;
+			}
+		}
+
+		// the schedulability tests assume a work-conserving policy that orders the jobs by a fixed key
+		// and dispatches a job as soon as it is released or a core becomes free
+		if constexpr (policy::sortThenPick<scheduler<Time>>::value
+					  && policy::jobLevelFixedPriority<scheduler<Time>>::value) {
+			if (!systemEvents.isAllEvent() && !(systemEvents.isArrivalEvent() && systemEvents.isCompletionEvent())) {
+				return r;
+			}
+			const sortKey key = scheduler<Time>::pickKey;
+			const bool front = scheduler<Time>::pickFront;
+			std::vector<std::string> methods;
+			for (std::size_t c = 0; c < clusters.size(); c++) {
+				const auto &cl = clusters[c];
+				Time ignored;
+				std::string method;
+				if (cl.empty()) {
+					continue;
+				} else if (dedicatedCores(cl, processors[c].getNumCores())) {
+					method = "Dedicated cores";
+				} else if (processors[c].getNumCores() > 1) {
+					return r;
+				} else if (taskKey(key, cl.front(), ignored) && fixedPriorityRTA(cl, key, front)) {
+					method = "RTA";
+				} else if (key == deadline && front && edfDemand(cl, hyperperiod)) {
+					method = "EDF demand";
+				} else {
+					return r;
+				}
+				if (std::find(methods.begin(), methods.end(), method) == methods.end()) {
+					methods.push_back(method);
+				}
+			}
+			r.conclusive = true;
+			r.schedulable = true;
+			for (const auto &m: methods) {
+				r.method += (r.method.empty() ? "" : "+") + m;
+			}
+		}
+		return r;
+	}
+
+}
+
+#endif
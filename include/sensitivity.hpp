@@ -0,0 +1,267 @@
+#ifndef SENSITIVITY_HPP
+#define SENSITIVITY_HPP
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include "job.hpp"
+#include "task.hpp"
+#include "processor.hpp"
+#include "csvfile.h"
+#include "TextTable.hpp"
+#include "formattedLog.hpp"
+#include "transitionSystem.hpp"
+#include "models/events.hpp"
+
+// the largest factor by which the execution times of the jobs of one task (or of all jobs, for the breakdown
+// utilization) can be scaled with the task set staying schedulable
+// the factor is bisected with several points per round, each analyzed on a thread of its own; an analysis stops
+// at its first deadline miss, and a miss also stops the analyses of the larger factors of the round
+// (the search assumes that schedulability is monotonic in the execution times)
+// each probe explores its own copy of the jobs from the initial state: the execution times are part of every state
+// (the core availabilities), so the states of one factor cannot seed the exploration of another
+template<class Time>
+class sensitivity {
+public:
+	struct probe {
+		unsigned int round = 0;
+		double factor = 0;
+		bool schedulable = false;
+		// stopped by a deadline miss at a smaller factor
+		bool stopped = false;
+		bool timedOut = false;
+		unsigned long numStates = 0;
+		double wallTime = 0;
+	};
+
+	// scaledTask: the name of the task whose jobs are scaled, empty to scale all jobs
+	sensitivity(const std::vector<job<Time>> &jobs, const std::vector<task<Time>> &tasks,
+				const events<Time> &systemEvents, const std::vector<processor> &processors, double timeout,
+				std::string scaledTask)
+			: jobs(jobs), tasks(tasks), systemEvents(systemEvents), processors(processors), timeout(timeout),
+			  scaledTask(std::move(scaledTask)) {
+		for (const auto &j: jobs) {
+			scaled.push_back(isScaled(j.getTaskName()) && j.getCost().max() > 0);
+		}
+	}
+
+	bool scalesAny() const {
+		return std::find(scaled.begin(), scaled.end(), true) != scaled.end();
+	}
+
+	// bisect until the largest schedulable factor is known within the given precision
+	void search(double precision = 0.01) {
+		auto start = std::chrono::steady_clock::now();
+		const unsigned int numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		// beyond this factor, a scaled job released as late as possible misses its deadline even if it starts
+		// at once: the upper bound is probed in the first round
+		double lo = 0;
+		double hi = std::numeric_limits<double>::infinity();
+		for (std::size_t i = 0; i < jobs.size(); i++) {
+			if (scaled[i]) {
+				hi = std::min(hi, (double) (jobs[i].getDeadline() - jobs[i].getArrival().max())
+								  / (double) jobs[i].getCost().max());
+			}
+		}
+		hi = std::max(hi, 0.0);
+		bool hiProbed = false;
+		largest = 0;
+
+		for (unsigned int round = 0; !hiProbed || hi - lo > precision; round++) {
+			// points spread over (lo, hi), including hi while it is not probed
+			std::vector<double> factors;
+			for (unsigned int i = 1; i <= numThreads; i++) {
+				factors.push_back(lo + (hi - lo) * i / (hiProbed ? numThreads + 1 : numThreads));
+			}
+			std::size_t first = probes.size();
+			runRound(round, factors);
+
+			// the smallest factor with a deadline miss bounds the search from above
+			// (a probe that timed out is neither schedulable nor a miss, it does not move the bounds)
+			double miss = hiProbed ? hi : std::numeric_limits<double>::infinity();
+			bool undecided = false;
+			for (std::size_t p = first; p < probes.size(); p++) {
+				if (probes[p].timedOut) {
+					undecided = true;
+				} else if (!probes[p].schedulable && !probes[p].stopped) {
+					miss = std::min(miss, probes[p].factor);
+				}
+			}
+			const double previousLo = lo, previousHi = hi;
+			for (std::size_t p = first; p < probes.size(); p++) {
+				if (probes[p].schedulable && probes[p].factor < miss) {
+					lo = std::max(lo, probes[p].factor);
+				} else if (probes[p].schedulable) {
+					log<LOG_WARNING>("Schedulable at scale %1% but not at %2%") % probes[p].factor % miss;
+				}
+			}
+			if (miss == std::numeric_limits<double>::infinity() && !undecided) {
+				// schedulable up to the upper bound
+				lo = hi;
+				break;
+			}
+			hi = std::min(hi, miss);
+			hiProbed = true;
+			if (undecided && lo == previousLo && hi == previousHi) {
+				log<LOG_WARNING>("The probes above scale %1% timed out") % lo;
+				break;
+			}
+		}
+		largest = lo;
+		wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// the largest factor found schedulable (0 if none)
+	double getFactor() const {
+		return largest;
+	}
+
+	std::stringstream getFormattedOutput() const {
+		std::stringstream ss;
+		TextTable t('-', '|', '+');
+		t.add(" Scaled jobs ");
+		t.add(" Largest scale ");
+		t.add(" Utilization ");
+		t.add(" Probes ");
+		t.add(" Wall time(s) ");
+		t.endOfRow();
+		t.add(scaledTask.empty() ? "all" : scaledTask);
+		t.add(std::to_string(largest));
+		t.add(std::to_string(utilization(largest)));
+		t.add(std::to_string(probes.size()));
+		t.add(std::to_string(wallTime));
+		t.endOfRow();
+		ss << t;
+
+		TextTable pt('-', '|', '+');
+		pt.add(" Round ");
+		pt.add(" Scale ");
+		pt.add(" Utilization ");
+		pt.add(" Schedulable? ");
+		pt.add(" #States ");
+		pt.add(" Wall time(s) ");
+		pt.endOfRow();
+		for (const auto &p: probes) {
+			pt.add(std::to_string(p.round));
+			pt.add(std::to_string(p.factor));
+			pt.add(std::to_string(utilization(p.factor)));
+			pt.add(outcome(p));
+			pt.add(std::to_string(p.numStates));
+			pt.add(std::to_string(p.wallTime));
+			pt.endOfRow();
+		}
+		ss << pt;
+		return ss;
+	}
+
+	void makeCSVFile(const std::string &fileName) const {
+		csvfile csv(fileName, false, ",");
+		csv << "Round" << "Scale" << "Utilization" << "Schedulable" << "States" << "Wall time" << endrow;
+		for (const auto &p: probes) {
+			csv << p.round << p.factor << utilization(p.factor) << outcome(p) << p.numStates << p.wallTime << endrow;
+		}
+	}
+
+private:
+	const std::vector<job<Time>> &jobs;
+	const std::vector<task<Time>> &tasks;
+	const events<Time> systemEvents;
+	const std::vector<processor> processors;
+	const double timeout;
+	const std::string scaledTask;
+	std::vector<bool> scaled;
+
+	std::vector<probe> probes;
+	double largest = 0;
+	double wallTime = 0;
+
+	bool isScaled(const std::string &taskName) const {
+		return scaledTask.empty() || taskName == scaledTask;
+	}
+
+	static std::string outcome(const probe &p) {
+		return p.schedulable ? "Yes" : p.timedOut ? "Timeout" : p.stopped ? "Stopped" : "No";
+	}
+
+	// utilization of the periodic tasks with scaled execution times
+	double utilization(double factor) const {
+		double u = 0;
+		for (const auto &t: tasks) {
+			u += (double) t.getMaxCost() * (isScaled(t.getName()) ? factor : 1.0) / (double) t.getPeriod();
+		}
+		return u;
+	}
+
+	static Time scale(Time t, double factor) {
+		if constexpr (std::is_floating_point<Time>::value) {
+			return t * factor;
+		} else {
+			// round up (the tolerance keeps 10 * 1.1 = 11.000000000000002 from rounding up to 12)
+			return (Time) std::ceil((double) t * factor - 1e-9);
+		}
+	}
+
+	std::vector<job<Time>> scaledJobs(double factor) const {
+		std::vector<job<Time>> result;
+		result.reserve(jobs.size());
+		for (std::size_t i = 0; i < jobs.size(); i++) {
+			const job<Time> &j = jobs[i];
+			if (!scaled[i]) {
+				result.push_back(j);
+				continue;
+			}
+			result.emplace_back(j.getName(), j.getID(), j.getArrival(),
+								Interval<Time>(scale(j.getCost().min(), factor), scale(j.getCost().max(), factor)),
+								j.getDeadline(), j.getAssignedProcessorSet(), j.getPriority(), j.getTaskPeriod());
+		}
+		return result;
+	}
+
+	// analyze the factors of one round concurrently
+	void runRound(unsigned int round, const std::vector<double> &factors) {
+		std::vector<std::shared_ptr<std::atomic<bool>>> stop;
+		for (std::size_t i = 0; i < factors.size(); i++) {
+			stop.push_back(std::make_shared<std::atomic<bool>>(false));
+		}
+		std::vector<probe> results(factors.size());
+		std::vector<std::thread> threads;
+		for (std::size_t i = 0; i < factors.size(); i++) {
+			threads.emplace_back([&, i]() {
+				auto start = std::chrono::steady_clock::now();
+				std::vector<processor> cores(processors);
+				auto ts = transitionSystem<Time>::constructProbe("", scaledJobs(factors[i]), systemEvents, cores,
+																 timeout, stop[i]);
+				probe &p = results[i];
+				p.round = round;
+				p.factor = factors[i];
+				p.schedulable = ts.isSchedulable();
+				p.timedOut = ts.isTimedOut();
+				p.stopped = !p.schedulable && !p.timedOut && !ts.foundDeadlineMiss();
+				p.numStates = ts.getNumStates();
+				p.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+				if (ts.foundDeadlineMiss()) {
+					for (std::size_t j = 0; j < factors.size(); j++) {
+						if (factors[j] > factors[i]) {
+							*stop[j] = true;
+						}
+					}
+				}
+			});
+		}
+		for (auto &t: threads) {
+			t.join();
+		}
+		probes.insert(probes.end(), results.begin(), results.end());
+	}
+};
+
+#endif
@@ -0,0 +1,283 @@
+#ifndef SIMULATOR_HPP
+#define SIMULATOR_HPP
+
+#include <vector>
+#include <string>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <unordered_map>
+#include <type_traits>
+#include "job.hpp"
+#include "queue.hpp"
+#include "processor.hpp"
+#include "cpuTime.hpp"
+#include "csvfile.h"
+#include "models/events.hpp"
+#include "models/scheduler.hpp"
+
+// concrete schedules of the jobs with sampled release times and execution times, replayed with the same
+// scheduler as the analysis: a deadline miss of a concrete schedule is a counterexample to schedulability,
+// the observed completion times are lower bounds of the analyzed ones
+template<class Time>
+class simulator {
+public:
+	// the concrete release time and execution time of each job (in the order of the jobs)
+	struct scenario {
+		std::vector<Time> arrival;
+		std::vector<Time> cost;
+	};
+
+	simulator(const std::vector<job<Time>> &jobs, const events<Time> &systemEvents,
+			  const std::vector<processor> &processors)
+			: jobs(jobs), systemEvents(systemEvents) {
+		for (std::size_t i = 0; i < jobs.size(); i++) {
+			jobsByID.emplace(jobs[i].getID(), jobs[i]);
+			indexByID.emplace(jobs[i].getID(), i);
+		}
+		for (const auto &p: processors) {
+			numCores.push_back(p.getNumCores());
+		}
+		eventTimes = systemEvents.getTimes();
+		std::sort(eventTimes.begin(), eventTimes.end());
+	}
+
+	// replay the given number of schedules on all hardware threads, stops at the first deadline miss
+	// the first schedules are the extreme points (earliest and latest releases with all BCETs and all WCETs),
+	// then every other schedule takes each release and execution time at one end of its interval
+	// (scheduling anomalies need such mixes) and the others sample them uniformly
+	void simulate(unsigned long numSchedules) {
+		timer.start();
+		unsigned int numThreads = std::max(1u, std::thread::hardware_concurrency());
+		numThreads = (unsigned int) std::min<unsigned long>(numThreads, numSchedules);
+		std::atomic<unsigned long> next{0};
+		std::atomic<bool> stop{false};
+		std::mutex resultLock;
+		observed.clear();
+
+		auto worker = [&]() {
+			scheduler<Time> policy(jobsByID);
+			std::vector<Time> finish;
+			std::unordered_map<jobID, Interval<Time>> local;
+			for (unsigned long i = next++; i < numSchedules && !stop; i = next++) {
+				scenario sc = makeScenario(i);
+				std::size_t missed = 0;
+				bool miss = replay(policy, sc, finish, missed);
+				numRuns++;
+				for (std::size_t j = 0; j < jobs.size(); j++) {
+					if (finish[j] < 0) {
+						continue;
+					}
+					auto it = local.find(jobs[j].getID());
+					if (it == local.end()) {
+						local.emplace(jobs[j].getID(), Interval<Time>{finish[j], finish[j]});
+					} else {
+						it->second |= Interval<Time>{finish[j], finish[j]};
+					}
+				}
+				if (miss) {
+					stop = true;
+					std::lock_guard<std::mutex> guard(resultLock);
+					if (!missFound || i < counterexampleRun) {
+						missFound = true;
+						counterexampleRun = i;
+						counterexample = sc;
+						counterexampleFinish = finish;
+						missedJob = missed;
+					}
+				}
+			}
+			std::lock_guard<std::mutex> guard(resultLock);
+			for (const auto &o: local) {
+				auto it = observed.find(o.first);
+				if (it == observed.end()) {
+					observed.emplace(o.first, o.second);
+				} else {
+					it->second |= o.second;
+				}
+			}
+		};
+
+		std::vector<std::thread> threads;
+		for (unsigned int t = 0; t < numThreads; t++) {
+			threads.emplace_back(worker);
+		}
+		for (auto &t: threads) {
+			t.join();
+		}
+		timer.stop();
+	}
+
+	bool foundMiss() const {
+		return missFound;
+	}
+
+	unsigned long getNumRuns() const {
+		return numRuns;
+	}
+
+	const cpuTime &getTimer() const {
+		return timer;
+	}
+
+	// earliest and latest observed completion time of each job
+	const std::unordered_map<jobID, Interval<Time>> &getObservedCompletions() const {
+		return observed;
+	}
+
+	// the concrete schedule that misses a deadline: release, execution, start, and completion time of each job
+	// (-1 for the jobs that were not started)
+	void makeCounterexampleFile(const std::string &fileName, Time timeScale) const {
+		csvfile csv(fileName, false, ",");
+		csv << "Task ID" << "Job ID" << "Arrival" << "Cost" << "Start" << "Finish" << "Missed" << endrow;
+		for (std::size_t j = 0; j < jobs.size(); j++) {
+			const Time f = counterexampleFinish[j];
+			csv << jobs[j].getID().task << jobs[j].getID().job << counterexample.arrival[j] * timeScale
+				<< counterexample.cost[j] * timeScale << (f < 0 ? -1 : (f - counterexample.cost[j]) * timeScale)
+				<< (f < 0 ? -1 : f * timeScale) << (j == missedJob ? "Yes" : "No") << endrow;
+		}
+	}
+
+private:
+	const std::vector<job<Time>> &jobs;
+	const events<Time> systemEvents;
+	std::unordered_map<jobID, job<Time>> jobsByID;
+	std::unordered_map<jobID, std::size_t> indexByID;
+	std::vector<unsigned int> numCores;
+	std::vector<Time> eventTimes;
+
+	cpuTime timer;
+	std::atomic<unsigned long> numRuns{0};
+	std::unordered_map<jobID, Interval<Time>> observed;
+	bool missFound = false;
+	unsigned long counterexampleRun = 0;
+	scenario counterexample;
+	std::vector<Time> counterexampleFinish;
+	std::size_t missedJob = 0;
+
+	scenario makeScenario(unsigned long i) const {
+		scenario sc;
+		sc.arrival.resize(jobs.size());
+		sc.cost.resize(jobs.size());
+		std::mt19937_64 rng(i);
+		for (std::size_t j = 0; j < jobs.size(); j++) {
+			const auto a = jobs[j].getArrival();
+			const auto c = jobs[j].getCost();
+			if (i < 4) {
+				sc.arrival[j] = i < 2 ? a.min() : a.max();
+				sc.cost[j] = i % 2 == 0 ? c.min() : c.max();
+			} else if (i % 2 == 1) {
+				sc.arrival[j] = rng() % 2 ? a.min() : a.max();
+				sc.cost[j] = rng() % 2 ? c.min() : c.max();
+			} else {
+				sc.arrival[j] = sample(rng, a);
+				sc.cost[j] = sample(rng, c);
+			}
+		}
+		return sc;
+	}
+
+	static Time sample(std::mt19937_64 &rng, const Interval<Time> &range) {
+		if constexpr (std::is_floating_point<Time>::value) {
+			return std::uniform_real_distribution<Time>(range.min(), range.max())(rng);
+		} else {
+			return std::uniform_int_distribution<Time>(range.min(), range.max())(rng);
+		}
+	}
+
+	// replay one schedule: the scheduler is called at each event (as in the analysis) with the released jobs
+	// whose cluster has a free core, and again at the same time after each dispatch
+	// returns true if a job misses its deadline (or is never dispatched), finish is -1 for jobs not started
+	bool replay(scheduler<Time> &policy, const scenario &sc, std::vector<Time> &finish, std::size_t &missed) const {
+		const std::size_t n = jobs.size();
+		finish.assign(n, Time(-1));
+		std::vector<std::vector<Time>> coreFree(numCores.size());
+		for (std::size_t c = 0; c < numCores.size(); c++) {
+			coreFree[c].assign(numCores[c], Time(0));
+		}
+		std::vector<Time> completions;
+		std::vector<jobID> ready;
+		std::vector<unsigned int> available(numCores.size());
+		std::size_t numDispatched = 0;
+		Time t = 0;
+
+		while (numDispatched < n) {
+			for (std::size_t c = 0; c < numCores.size(); c++) {
+				available[c] = (unsigned int) std::count_if(coreFree[c].begin(), coreFree[c].end(),
+															 [t](Time f) { return f <= t; });
+			}
+			ready.clear();
+			for (std::size_t j = 0; j < n; j++) {
+				if (finish[j] >= 0 || sc.arrival[j] > t) {
+					continue;
+				}
+				// the job cannot finish in time any more
+				if (jobs[j].exceedsDeadline(t + sc.cost[j])) {
+					missed = j;
+					return true;
+				}
+				if (available[jobs[j].getAssignedProcessorSet()] > 0) {
+					ready.push_back(jobs[j].getID());
+				}
+			}
+
+			if (!ready.empty()) {
+				queue<Time> rq(jobsByID, ready);
+				auto selected = policy.callScheduler(rq, available, t);
+				if (selected != std::nullopt) {
+					const std::size_t j = indexByID.find(selected.value())->second;
+					auto &cores = coreFree[jobs[j].getAssignedProcessorSet()];
+					auto core = std::min_element(cores.begin(), cores.end());
+					finish[j] = t + sc.cost[j];
+					*core = finish[j];
+					completions.push_back(finish[j]);
+					numDispatched++;
+					if (jobs[j].exceedsDeadline(finish[j])) {
+						missed = j;
+						return true;
+					}
+					continue;
+				}
+			}
+
+			// next scheduling event
+			// (with an event at every time instant, an empty ready queue only changes at a release or a completion)
+			const bool all = systemEvents.isAllEvent();
+			Time next = timeModel::constants<Time>::infinity();
+			for (std::size_t j = 0; j < n; j++) {
+				if (finish[j] < 0 && sc.arrival[j] > t && (all || systemEvents.isArrivalEvent())) {
+					next = std::min(next, sc.arrival[j]);
+				}
+			}
+			for (auto f: completions) {
+				if (f > t && (all || systemEvents.isCompletionEvent())) {
+					next = std::min(next, f);
+				}
+			}
+			auto e = std::upper_bound(eventTimes.begin(), eventTimes.end(), t);
+			if (e != eventTimes.end()) {
+				next = std::min(next, *e);
+			}
+			if (all && !ready.empty()) {
+				next = std::min(next, t + timeModel::constants<Time>::epsilon());
+			}
+			if (next == timeModel::constants<Time>::infinity()) {
+				break;
+			}
+			t = next;
+		}
+
+		// a job that is never dispatched misses its deadline
+		for (std::size_t j = 0; j < n; j++) {
+			if (finish[j] < 0) {
+				missed = j;
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+#endif
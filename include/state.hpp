@@ -2,6 +2,7 @@
 #define STATE_HPP
 
 #include <cassert>
+#include <cstdint>
 #include <functional> // for hash
 #include <algorithm>
 #include "job.hpp"
@@ -26,6 +27,8 @@ private:
 	std::vector<std::vector<Interval<Time>>> processorAvailability;
 	// state's event set
 	std::set<Time> eventSet;
+	// order-independent hash of the event set (maintained on insertion and removal)
+	std::size_t eventSetHash = 0;
 	// state hash
 	std::size_t lookupKey;
 	// Considering completion events
@@ -43,16 +46,40 @@ public:
 			}
 		}
 		assert(processorAvailability.size() > 0);
+		for (const auto &e: this->eventSet) {
+			eventSetHash += hashOfEvent(e);
+		}
+	}
+
+	// restored state -- a state of a stored frontier, its lookup key is made from the dispatched jobs
+	// (the job indices are sorted)
+	state(unsigned long id, Time timeStamp, const std::vector<const job<Time> *> &dispatchedJobs,
+		  const std::vector<std::size_t> &jobIndices, std::vector<std::vector<Interval<Time>>> availability,
+		  std::set<Time> eventSet, bool completionEvents)
+			: timeStamp(timeStamp), stateID(id), dispatched(jobIndices.empty() ? indexSet() : indexSet(indexSet(), jobIndices)),
+			  numDispatchedJob(jobIndices.size()), processorAvailability(std::move(availability)),
+			  eventSet(std::move(eventSet)), completionEvents(completionEvents), lookupKey(0x9a9a9a9a9a9a9a9aUL) {
+		for (const auto *j: dispatchedJobs) {
+			lookupKey ^= j->getHash();
+#if defined(COLLECT_TLTS_GRAPH) || defined(DEBUG)
+			dispatchedPointer.push_back(j);
+#endif
+		}
+		for (const auto &e: this->eventSet) {
+			eventSetHash += hashOfEvent(e);
+		}
 	}
 
 	// dispatch transition: new state by scheduling a job in an existing state globally
+	// the completion events of the job can be left out if they cannot change any decision
 	state(const state &from, unsigned long id, const job<Time> &s, const std::size_t &jobIndex, std::size_t processor,
-		  Interval<Time> finishTime)
+		  Interval<Time> finishTime, bool earliestCompletionEvent = true, bool latestCompletionEvent = true)
 			: timeStamp(from.timeStamp), dispatched{from.dispatched, jobIndex},numDispatchedJob(from.numDispatchedJob + 1),
 			  dispatchedPointer(from.dispatchedPointer), jobsFinishTimes(from.jobsFinishTimes),
 			  eventSet(from.eventSet), completionEvents(from.completionEvents),
 			  processorAvailability(from.processorAvailability) {
 		stateID = id;
+		eventSetHash = from.eventSetHash;
 #if defined(COLLECT_TLTS_GRAPH) || defined(DEBUG)
 		dispatchedPointer.push_back(&s);
 
@@ -60,8 +87,10 @@ public:
 		 jobsFinishTimes.emplace(s.getID(), finishTime);
 #endif
 		if (completionEvents) {
-			addEvent(finishTime.min());
-			addEvent(finishTime.max());
+			if (earliestCompletionEvent)
+				addEvent(finishTime.min());
+			if (latestCompletionEvent)
+				addEvent(finishTime.max());
 		}
 
 		lookupKey = from.getLookupKey() ^ s.getHash();
@@ -102,7 +131,8 @@ public:
 		assert(timeStamp > from.timeStamp);
 
 		// remove events that are no longer valid
-		eventSet.erase(eventSet.begin(), eventSet.upper_bound(time));
+		eventSetHash = from.eventSetHash;
+		eraseEventsUntil(time);
 
 	}
 
@@ -111,7 +141,27 @@ public:
 //			eventSet.push_back(time);
 //		}
 //		std::sort(eventSet.begin(), eventSet.end());
-		eventSet.insert(time);
+		if (eventSet.insert(time).second) {
+			eventSetHash += hashOfEvent(time);
+		}
+	}
+
+	// remove all events up to (and including) the given time
+	void eraseEventsUntil(Time time) {
+		auto last = eventSet.upper_bound(time);
+		for (auto it = eventSet.begin(); it != last; ++it) {
+			eventSetHash -= hashOfEvent(*it);
+		}
+		eventSet.erase(eventSet.begin(), last);
+	}
+
+	// the events are mixed (splitmix64) before they are summed, an affine hash would make every two event sets
+	// of the same size and sum collide
+	static std::size_t hashOfEvent(Time time) {
+		std::uint64_t z = (std::uint64_t) std::hash<Time>{}(time) + 0x9e3779b97f4a7c15UL;
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9UL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebUL;
+		return (std::size_t) (z ^ (z >> 31));
 	}
 
 	Time getNextEventTime() const {
@@ -119,6 +169,30 @@ public:
 		return *eventSet.begin();
 	}
 
+	// first event at or after the given time (infinity if there is none)
+	Time getEventFrom(Time from) const {
+		auto it = eventSet.lower_bound(from);
+		return it == eventSet.end() ? timeModel::constants<Time>::infinity() : *it;
+	}
+
+	// first event after the given time (infinity if there is none)
+	Time getEventAfter(Time time) const {
+		auto it = eventSet.upper_bound(time);
+		return it == eventSet.end() ? timeModel::constants<Time>::infinity() : *it;
+	}
+
+	std::size_t getEventSetHash() const {
+		return eventSetHash;
+	}
+
+	const indexSet &getDispatchedSet() const {
+		return dispatched;
+	}
+
+	const std::vector<std::vector<Interval<Time>>> &getProcessorAvailability() const {
+		return processorAvailability;
+	}
+
 	unsigned long getNumberOfDispatchedJobs() const {
 		return numDispatchedJob;
 	}
@@ -170,6 +244,22 @@ public:
 		return true;
 	}
 
+	// the merge adds no availability that neither state has on the cores of the given clusters: their
+	// availability intervals overlap
+	bool mergesExactly(const state &other, const std::vector<bool> &clusters) const {
+		for (std::size_t i = 0; i < processorAvailability.size(); i++) {
+			if (i >= clusters.size() || !clusters[i]) {
+				continue;
+			}
+			for (std::size_t j = 0; j < processorAvailability[i].size(); j++) {
+				if (processorAvailability[i][j].disjoint(other.processorAvailability[i][j])) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
 	bool tryToMerge(const state &other) {
 		if (!canMergeWith(other)) {
 			return false;
@@ -180,7 +270,9 @@ public:
 		auto it1 = jobsFinishTimes.begin();
 
 		while (it1 != jobsFinishTimes.end()) {
-			jointJobs.emplace(it1->first, it1->second | other.jobsFinishTimes.find(it1->first)->second);
+			// (a restored state does not know the finish times of its jobs)
+			auto it2 = other.jobsFinishTimes.find(it1->first);
+			jointJobs.emplace(it1->first, it2 == other.jobsFinishTimes.end() ? it1->second : it1->second | it2->second);
 			it1++;
 		}
 
@@ -213,7 +305,7 @@ public:
 	}
 
 	// get the state's event set
-	std::set<Time> getEventSet() const {
+	const std::set<Time> &getEventSet() const {
 		return eventSet;
 	}
 
@@ -224,7 +316,7 @@ public:
 		timeStamp = newTime;
 
 		// remove events that are no longer valid
-		eventSet.erase(eventSet.begin(), eventSet.upper_bound(newTime));
+		eraseEventsUntil(newTime);
 
 	}
 
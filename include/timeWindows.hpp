@@ -0,0 +1,88 @@
+#ifndef TIME_WINDOWS_HPP
+#define TIME_WINDOWS_HPP
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include "job.hpp"
+#include "time.hpp"
+#include "models/events.hpp"
+
+// the schedule cut into time windows [t_k, t_k+1) that are analyzed as separate models
+// a window starts at an instant t that no job spans: every job released before t has its deadline by t, so
+// unless a deadline is missed before t, every state at t has dispatched exactly the jobs released before t,
+// and all cores are free; the window starts from that single state (the initial state of its own jobs)
+// t must also be a scheduling event in every state, so the scheduler observes the window's first releases
+// the same way (t is a release of a job of the window, observed with the arrival events or every instant,
+// or one of the explicit event times)
+template<class Time>
+class timeWindows {
+public:
+	// at most the given number of windows, with similar numbers of jobs
+	timeWindows(const std::vector<job<Time>> &jobs, const events<Time> &systemEvents, unsigned int maxWindows)
+			: jobs(jobs) {
+		std::vector<std::size_t> order(jobs.size());
+		for (std::size_t i = 0; i < order.size(); i++) {
+			order[i] = i;
+		}
+		std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+			return jobs[a].getArrival().min() < jobs[b].getArrival().min();
+		});
+
+		// the instants no job spans, with the number of jobs released before each
+		const std::vector<Time> eventTimes = systemEvents.getTimes();
+		std::vector<std::pair<Time, std::size_t>> cuts;
+		Time latestDeadline = 0;
+		for (std::size_t k = 0; k < order.size(); k++) {
+			const Time t = jobs[order[k]].getArrival().min();
+			bool observed = systemEvents.isAllEvent() || systemEvents.isArrivalEvent()
+							|| std::find(eventTimes.begin(), eventTimes.end(), t) != eventTimes.end();
+			if (k > 0 && t > 0 && t != jobs[order[k - 1]].getArrival().min() && latestDeadline <= t && observed) {
+				cuts.emplace_back(t, k);
+			}
+			latestDeadline = std::max(latestDeadline,
+									  jobs[order[k]].getDeadline() + timeModel::constants<Time>::deadlineMissTolerance());
+		}
+
+		// the cut closest to each multiple of jobs/windows
+		starts.push_back(0);
+		std::size_t next = 0;
+		for (unsigned int w = 1; w < maxWindows && next < cuts.size(); w++) {
+			const double target = (double) jobs.size() * w / maxWindows;
+			while (next + 1 < cuts.size()
+				   && std::abs((double) cuts[next + 1].second - target) <= std::abs((double) cuts[next].second - target)) {
+				next++;
+			}
+			starts.push_back(cuts[next].first);
+			next++;
+		}
+	}
+
+	std::size_t getNumWindows() const {
+		return starts.size();
+	}
+
+	// the first instant of each window
+	const std::vector<Time> &getStarts() const {
+		return starts;
+	}
+
+	// the jobs released in the given window
+	std::vector<job<Time>> window(std::size_t index) const {
+		std::vector<job<Time>> result;
+		for (const auto &j: jobs) {
+			if (j.getArrival().min() >= starts[index]
+				&& (index + 1 == starts.size() || j.getArrival().min() < starts[index + 1])) {
+				result.push_back(j);
+			}
+		}
+		return result;
+	}
+
+private:
+	const std::vector<job<Time>> &jobs;
+	std::vector<Time> starts;
+};
+
+#endif
@@ -11,6 +11,7 @@
 #include "time.hpp"
 #include "task.hpp"
 #include "processor.hpp"
+#include "models/events.hpp"
 
 namespace tools {
     // observation window length
@@ -38,22 +39,84 @@ namespace tools {
         return h;
     }
 
+    // common divisor of all time parameters of the workload and of the event times
+    // (1 for dense time or if there is no common divisor)
+    template<typename Time>
+    Time timeBase(const std::vector<task<Time>> &tasks, const std::vector<job<Time>> &segments,
+                  const events<Time> &systemEvents) {
+        if constexpr (!std::is_integral<Time>::value) {
+            return Time(1);
+        } else {
+            Time g = 0;
+            for (const auto &t: tasks) {
+                for (Time v: {t.getJitter(), t.getPeriod(), t.getMinCost(), t.getMaxCost(), t.getDeadline()})
+                    g = gcd(g, v);
+            }
+            for (const auto &s: segments) {
+                for (Time v: {s.getArrival().min(), s.getArrival().max(), s.getCost().min(), s.getCost().max(),
+                              s.getDeadline()})
+                    g = gcd(g, v);
+            }
+            for (Time v: systemEvents.getTimes())
+                g = gcd(g, v);
+            return g > 1 ? g : Time(1);
+        }
+    }
+
+    // divide all time parameters of the workload and the event times by the given time base
+    // (priorities are not times and are kept)
+    template<typename Time>
+    void scaleTime(std::vector<task<Time>> &tasks, std::vector<job<Time>> &segments, events<Time> &systemEvents,
+                   Time base) {
+        for (auto &t: tasks) {
+            t = task<Time>(t.getName(), t.getTaskID(), t.getJitter() / base, t.getPeriod() / base,
+                           Interval<Time>(t.getMinCost() / base, t.getMaxCost() / base), t.getDeadline() / base,
+                           t.getAssignedProcessorSet(), t.getPriority());
+        }
+        for (auto &s: segments) {
+            s = job<Time>(s.getName(), s.getID(),
+                          Interval<Time>(s.getArrival().min() / base, s.getArrival().max() / base),
+                          Interval<Time>(s.getCost().min() / base, s.getCost().max() / base),
+                          s.getDeadline() / base, s.getAssignedProcessorSet(), s.getPriority());
+        }
+        std::vector<Time> times = systemEvents.getTimes();
+        for (auto &v: times)
+            v /= base;
+        systemEvents = events<Time>(systemEvents.isAllEvent(), systemEvents.isArrivalEvent(),
+                                    systemEvents.isCompletionEvent(), times);
+    }
+
     //Function to generate all segments in the system
+    // the jobs of several hyperperiods are generated hyperperiod by hyperperiod, so that the
+    // i-th job of a hyperperiod and the i-th job of the next one differ by a constant index
     template<typename Time>
-    std::vector<job<Time>> generateSegments(std::vector<task<Time>> tasks, std::vector<job<Time>> segments) {
+    std::vector<job<Time>> generateSegments(std::vector<task<Time>> tasks, std::vector<job<Time>> segments,
+                                            unsigned int hyperperiods = 1) {
         std::vector<job<Time>> generatedSegments;
-        observationWindow = calHyperperiod(tasks);
+        Time hyperperiod = calHyperperiod(tasks);
+        observationWindow = hyperperiod * hyperperiods;
+
+        // count the jobs first, so that the vector is allocated once
+        std::size_t numJobs = segments.size();
         for (const auto &t_instance: tasks) {
-            unsigned long jobCounter = 0;
-            for (long long i = 0; i < observationWindow / t_instance.getPeriod(); i++) {
-                generatedSegments.emplace_back(t_instance.getName() + "," + std::to_string(jobCounter),
-                                               t_instance.getTaskID(), jobCounter,
-                                               Interval<Time>(t_instance.getPeriod() * i,
-                                                              t_instance.getPeriod() * i + t_instance.getJitter()),
-                                               t_instance.getCost(),
-                                               (t_instance.getPeriod() * i) + t_instance.getDeadline(),
-                                               t_instance.getAssignedProcessorSet(), t_instance.getPriority(),t_instance.getPeriod());
-                jobCounter++;
+            numJobs += (std::size_t) (hyperperiod / t_instance.getPeriod()) * hyperperiods;
+        }
+        generatedSegments.reserve(numJobs);
+
+        for (unsigned int h = 0; h < hyperperiods; h++) {
+            for (const auto &t_instance: tasks) {
+                long long jobsPerHyperperiod = hyperperiod / t_instance.getPeriod();
+                long long first = h * jobsPerHyperperiod;
+                const std::string prefix = t_instance.getName() + ",";
+                for (long long i = first; i < first + jobsPerHyperperiod; i++) {
+                    generatedSegments.emplace_back(prefix + std::to_string(i),
+                                                   t_instance.getTaskID(), i,
+                                                   Interval<Time>(t_instance.getPeriod() * i,
+                                                                  t_instance.getPeriod() * i + t_instance.getJitter()),
+                                                   t_instance.getCost(),
+                                                   (t_instance.getPeriod() * i) + t_instance.getDeadline(),
+                                                   t_instance.getAssignedProcessorSet(), t_instance.getPriority(),t_instance.getPeriod());
+                }
             }
         }
 
@@ -87,6 +150,17 @@ namespace tools {
         std::unordered_map<jobID, Interval<Time>> responseTimes;
     };
 
+    // periodic workload generated for several hyperperiods
+    template<class Time>
+    struct horizon {
+        Time hyperperiod = 0;
+        // number of jobs generated per hyperperiod
+        std::size_t jobsPerHyperperiod = 0;
+        unsigned int numHyperperiods = 1;
+        // the times are in units of timeScale (see scaleTime)
+        Time timeScale = 1;
+    };
+
     template<class Time>
     struct inputs {
         std::vector<job<Time>> segments;
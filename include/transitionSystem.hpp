@@ -10,6 +10,13 @@
 #include <queue>
 #include <optional>
 #include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <tuple>
+#include <map>
+#include <thread>
+#include <atomic>
+#include <mutex>
 #include "state.hpp"
 #include "cpuTime.hpp"
 #include "dag.hpp"
@@ -20,6 +27,16 @@
 #include "combinations.hpp"
 #include "TextTable.hpp"
 #include "queue.hpp"
+#include "decisionCache.hpp"
+#include "policyTraits.hpp"
+#include "resourceCombinations.hpp"
+#include "jobClassifier.hpp"
+#include "batchScheduler.hpp"
+#include "peekCache.hpp"
+#include "predecessorLog.hpp"
+#include "frontierStore.hpp"
+#include "uncertaintySplit.hpp"
+#include "timeWindows.hpp"
 
 #ifndef _WIN32
 
@@ -47,6 +64,13 @@ private:
 	std::priority_queue<stateID, std::vector<stateID>,
 		std::function<bool(stateID, stateID)>> explorableStates{
 		[this](stateID a, stateID b) {
+			if (falsification) {
+				Time slackA = slackOf.at(a);
+				Time slackB = slackOf.at(b);
+				if (slackA != slackB) {
+					return slackA > slackB;
+				}
+			}
 			const auto &stateA = statesByID.at(a);
 			const auto &stateB = statesByID.at(b);
 			if (stateA->getTimeStamp() == stateB->getTimeStamp()) {
@@ -60,6 +84,137 @@ private:
 	Jobs_lut _jobsByWin;
 
 	const Jobs_lut &jobsByWin;
+	// structure-of-arrays copy of the lookup table for batch classification
+	jobClassifier<Time> classifier;
+	typedef typename jobClassifier<Time>::classification classification;
+	// classification of the state that is explored and of the state that is peeked
+	classification exploreClassification;
+	classification peekClassification;
+	// classifications of unexplored states, derived from their parent when they were created by a dispatch
+	std::unordered_map<stateID, classification> pendingClassifications;
+	// the ready jobs of a classified state by certainty, in bucket order
+	struct readyJobs {
+		// possibly released, the core is possibly free
+		readyQueue possible;
+		// certainly released, the core is certainly free
+		readyQueue certain;
+		// certainly released, the core is possibly free
+		readyQueue released;
+
+		bool operator==(const readyJobs &other) const {
+			return possible == other.possible && certain == other.certain && released == other.released;
+		}
+	};
+	readyJobs exploreReady;
+	readyJobs peekReady;
+	enum class readiness {
+		possible, released, certain
+	};
+	// job-level fixed-priority, work-conserving policies only need the queues that make different decisions
+	static constexpr bool fixedPriorityFastPath = policy::jobLevelFixedPriority<scheduler<Time>>::value &&
+												  policy::sortThenPick<scheduler<Time>>::value;
+
+	// sorted times at which the classification of a job can change (releases, deadline misses, buckets)
+	std::vector<Time> timeline;
+	// the decision of the policy only depends on the classification of the jobs
+	// (a sort-then-pick policy orders jobs by laxity the same way at any time)
+	static constexpr bool timeIndependentPolicy = !policy::readsCurrentTime<scheduler<Time>>::value ||
+												  policy::sortThenPick<scheduler<Time>>::value;
+	// completion events that cannot change the classification of a job are not added to the event set
+	// (only if the policy does not see the available resources either)
+	static constexpr bool completionPruning = timeIndependentPolicy &&
+											  !policy::readsAvailableResources<scheduler<Time>>::value;
+	unsigned long numPrunedEvents = 0;
+
+	// symmetry reduction: jobs with identical parameters (the same job of identical tasks) are interchangeable,
+	// a state only dispatches the first undispatched job of its class, so that the dispatched jobs of each class
+	// form a prefix and symmetric states become equal
+	bool symmetryReduction = false;
+	std::vector<std::vector<std::size_t>> symmetryClasses;
+	std::vector<std::size_t> classOf;
+	unsigned long numSymmetricMerges = 0;
+
+	// partial-order reduction: after a dispatch, the scheduler is queried again on the rest of the same ready queue
+	// (the same jobs are released at the same time stamp); the jobs it selects on certainly free cores are
+	// dispatched in the same transition, so the intermediate states of the different dispatch orders are not stored
+	bool partialOrderReduction = false;
+	classification chainClassification;
+	classification nextChainClassification;
+	unsigned long numChainedDispatches = 0;
+
+	// falsification: the states are explored by deadline pressure (the least slack of their undispatched jobs)
+	// instead of by time stamp, and the exploration stops at the first possible deadline miss
+	// (the response times are not recorded)
+	bool falsification = false;
+	std::unordered_map<stateID, Time> slackOf;
+	// set by the first analysis of a cluster that finds a deadline miss, the others then stop as well
+	std::shared_ptr<std::atomic<bool>> missFound;
+
+	// number of clusters analyzed as separate transition systems
+	std::size_t numSubsystems = 1;
+
+	// sub-models with split arrival and execution-time intervals analyzed as separate transition systems
+	std::size_t numSubmodels = 1;
+	std::string splitIntervals;
+
+	// the first instants of the time windows analyzed as separate transition systems
+	std::vector<Time> windowStarts;
+
+	// counterexample-guided refinement of the merging: in the time range of the region, states are only merged
+	// if the merge is exact on the clusters of the region (see refineMerging)
+	struct mergeRegion {
+		Interval<Time> times;
+		std::vector<bool> clusters;
+	};
+	std::optional<mergeRegion> exactMerging;
+	bool refinement = false;
+	unsigned int numRefinements = 0;
+
+	// witnesses: the transition that created each state is logged to disk, so that one path to the latest
+	// completion of a job or to a deadline miss can be rebuilt after the exploration
+	// (witnessJobs: the labels of the jobs, or "all")
+	predecessorLog<Time> predecessors;
+	std::vector<std::string> witnessJobs;
+	struct witnessSource {
+		jobID job;
+		// the state the outcome follows from, the jobs dispatched from it, and the time of the outcome
+		stateID from;
+		std::string dispatched;
+		Time time;
+	};
+	std::unordered_map<jobID, witnessSource> completionSources;
+	std::optional<witnessSource> missSource;
+	// the state that is explored or peeked from
+	stateID witnessState = 0;
+	struct witness {
+		std::string outcome;
+		witnessSource source;
+		std::vector<typename predecessorLog<Time>::step> steps;
+	};
+	std::vector<witness> witnesses;
+
+	// concrete schedules replayed before the analysis, and the jobs whose analyzed latest completion time
+	// was also observed in one of them (the bound is exact)
+	unsigned long numSimulations = 0;
+	std::size_t numTightBounds = 0;
+
+	// incremental re-analysis: the frontiers of the exploration are stored at checkpoints, and the exploration
+	// of an edited model resumes from the last stored frontier before the earliest time at which a changed
+	// job can influence a decision
+	std::string frontierFile;
+	frontierStore<Time> frontiers;
+	Time checkpointStep = 0;
+	Time nextCheckpoint = 0;
+	// the latest time the exploration has looked at: the time stamps of the states and the completion times
+	// of the dispatched jobs (the time transitions peek up to the time stamp of the new state)
+	Time lookahead = 0;
+	// the stored frontier the exploration resumed from, and the number of states created before it
+	std::optional<Time> resumedAt;
+	unsigned long numReusedStates = 0;
+
+	// the method that decided the schedulability (an analytical test decides without exploring)
+	std::string method = "Exploration";
+	bool screened = false;
 
 
 	bool beNaive = false;
@@ -71,7 +226,49 @@ private:
 	const std::vector<processor> processors;
 	unsigned long numDispatchedJob = 0;
 	scheduler<Time> schedulingPolicy;
+	// cache of the scheduling decisions (shared pointer, so that it can be shared between analyses)
+	std::shared_ptr<decisionCache<Time>> decisions = std::make_shared<decisionCache<Time>>();
+	// number of available cores per cluster handed to the scheduler (one iterator per call site)
+	resourceCombinations exploreCombinations;
+	resourceCombinations peekCombinations;
+	resourceCombinations chainCombinations;
+	// batched evaluation of sort-then-pick policies (one evaluator per call site)
+	batchScheduler<Time> exploreBatch;
+	batchScheduler<Time> peekBatch;
+	// peeked time transitions, and the events the last peek moved to
+	peekCache<Time> peeks;
+	std::vector<Time> peekSteps;
 	std::string jobFile;
+	// the analysis runs in units of this time base, the response times are reported in the original units
+	Time timeScale = 1;
+
+	// steady-state detection over several hyperperiods
+	// a frontier state relative to a hyperperiod boundary: time values are shifted by the boundary,
+	// job indices by the number of jobs before it
+	struct frontierState {
+		Time timeStamp;
+		// jobs before the boundary that are not dispatched yet
+		std::vector<long long> carryIn;
+		// jobs after the boundary that are dispatched already
+		std::vector<long long> ahead;
+		std::vector<Time> availability;
+		// events within one hyperperiod
+		std::vector<Time> events;
+
+		bool operator<(const frontierState &other) const {
+			return std::tie(timeStamp, carryIn, ahead, availability, events)
+				   < std::tie(other.timeStamp, other.carryIn, other.ahead, other.availability, other.events);
+		}
+
+		bool operator==(const frontierState &other) const {
+			return std::tie(timeStamp, carryIn, ahead, availability, events)
+				   == std::tie(other.timeStamp, other.carryIn, other.ahead, other.availability, other.events);
+		}
+	};
+	tools::horizon<Time> horizon;
+	std::vector<frontierState> lastFrontier;
+	long long lastBoundary = -1;
+	bool steadyState = false;
 
 	// used in the result of the analysis
 	bool aborted = false;
@@ -85,11 +282,20 @@ public:
 	// Interface for constructing the transition system naively
 	static transitionSystem
 	constructNaively(std::string segFile, jobSet &workload, events<Time> systemEvents,
-					 std::vector<processor> &processors, double timeout) {
+					 std::vector<processor> &processors, double timeout, tools::horizon<Time> horizon = {},
+					 bool symmetry = false, bool partialOrder = false, bool falsify = false,
+					 std::vector<std::string> witnessJobs = {}, std::string frontierFile = "") {
 		std::vector<unsigned int> resourceSet = tools::generateResourceSet(processors);
 		auto ts = transitionSystem(workload, systemEvents, processors, resourceSet, timeout);
 		log<LOG_DEBUG>("Constructing transition system naively");
 		ts.jobFile = segFile;
+		ts.horizon = horizon;
+		if (symmetry)
+			ts.makeSymmetryClasses();
+		ts.partialOrderReduction = partialOrder;
+		ts.setFalsification(falsify);
+		ts.setWitnessJobs(witnessJobs);
+		ts.setFrontierFile(frontierFile);
 		ts.beNaive = true;
 		ts.timer.start();
 		ts.construct();
@@ -99,11 +305,20 @@ public:
 
 	static transitionSystem
 	construct(std::string segFile, jobSet jobs, events<Time> systemEvents,
-			  std::vector<processor> &processors, double timeout) {
+			  std::vector<processor> &processors, double timeout, tools::horizon<Time> horizon = {},
+			  bool symmetry = false, bool partialOrder = false, bool falsify = false,
+			  std::vector<std::string> witnessJobs = {}, std::string frontierFile = "") {
 		std::vector<unsigned int> resourceSet = tools::generateResourceSet(processors);
 		auto ts = transitionSystem(jobs, systemEvents, processors, resourceSet, timeout);
 		log<LOG_DEBUG>("Constructing transition system");
 		ts.jobFile = segFile;
+		ts.horizon = horizon;
+		if (symmetry)
+			ts.makeSymmetryClasses();
+		ts.partialOrderReduction = partialOrder;
+		ts.setFalsification(falsify);
+		ts.setWitnessJobs(witnessJobs);
+		ts.setFrontierFile(frontierFile);
 		ts.beNaive = false;
 		ts.timer.start();
 		ts.construct();
@@ -111,24 +326,351 @@ public:
 		return ts;
 	}
 
+	// analyze each cluster as a separate transition system (in parallel) if the policy decides for the jobs of a
+	// cluster independently of the other clusters; the decision points must not come from other clusters either,
+	// so each cluster has to observe its own arrivals and completions (or every time instant)
+	static transitionSystem
+	constructByCluster(std::string segFile, jobSet jobs, events<Time> systemEvents,
+					   std::vector<processor> &processors, double timeout, tools::horizon<Time> horizon = {},
+					   bool symmetry = false, bool partialOrder = false, bool falsify = false,
+					   std::vector<std::string> witnessJobs = {}, std::string frontierFile = "", bool refine = false) {
+		std::vector<jobSet> parts(processors.size());
+		for (const auto &j: jobs) {
+			parts[j.getAssignedProcessorSet()].push_back(j);
+		}
+		parts.erase(std::remove_if(parts.begin(), parts.end(), [](const jobSet &p) { return p.empty(); }),
+					parts.end());
+		bool independent = policy::clusterIndependent<scheduler<Time>>::value
+						   && (systemEvents.isAllEvent()
+							   || (systemEvents.isArrivalEvent() && systemEvents.isCompletionEvent()));
+		if (!independent || parts.size() < 2) {
+			if (refine) {
+				return constructRefined(segFile, jobs, systemEvents, processors, timeout, horizon, symmetry,
+										partialOrder, falsify, witnessJobs);
+			}
+			return construct(segFile, jobs, systemEvents, processors, timeout, horizon, symmetry, partialOrder,
+							 falsify, witnessJobs, frontierFile);
+		}
+
+		std::vector<unsigned int> resourceSet = tools::generateResourceSet(processors);
+		auto ts = transitionSystem(jobs, systemEvents, processors, resourceSet, timeout);
+		log<LOG_DEBUG>("Constructing %1% transition systems, one per cluster") % parts.size();
+		ts.jobFile = segFile;
+		ts.horizon = horizon;
+		if (symmetry)
+			ts.makeSymmetryClasses();
+		ts.partialOrderReduction = partialOrder;
+		ts.setFalsification(falsify);
+		// the clusters log their own transitions, their witnesses are collected here
+		ts.witnessJobs = witnessJobs;
+		// each cluster stores its frontiers in a file of its own
+		ts.frontierFile = frontierFile;
+		if (falsify)
+			ts.missFound = std::make_shared<std::atomic<bool>>(false);
+		ts.timer.start();
+
+		std::vector<std::unique_ptr<transitionSystem>> systems(parts.size());
+		std::vector<std::thread> threads;
+		for (std::size_t c = 0; c < parts.size(); c++) {
+			threads.emplace_back([&, c]() {
+				auto explore = [&, c](const std::optional<mergeRegion> &region, double limit) {
+					auto part = std::make_unique<transitionSystem>(parts[c], systemEvents, processors, resourceSet,
+																   limit);
+					part->horizon = horizon;
+					part->horizon.jobsPerHyperperiod = parts[c].size() / horizon.numHyperperiods;
+					if (symmetry)
+						part->makeSymmetryClasses();
+					part->partialOrderReduction = partialOrder;
+					part->setFalsification(falsify);
+					part->setWitnessJobs(witnessJobs);
+					if (!frontierFile.empty())
+						part->setFrontierFile(frontierFile + "." + std::to_string(c));
+					// the decision cache is thread-safe (and so is the deadline-miss flag)
+					// (a cluster that refines its merging must not be stopped by the unconfirmed miss of another)
+					part->decisions = ts.decisions;
+					if (!refine)
+						part->missFound = ts.missFound;
+					part->exactMerging = region;
+					part->timer.start();
+					part->construct();
+					part->timer.stop();
+					return part;
+				};
+				systems[c] = refine ? refineMerging(explore, timeout) : explore(std::nullopt, timeout);
+			});
+		}
+		for (auto &t: threads) {
+			t.join();
+		}
+
+		// the response times are reported for the first hyperperiod only if all clusters reached a steady state
+		bool allSteady = std::all_of(systems.begin(), systems.end(), [](const auto &p) { return p->steadyState; });
+		ts.completed = true;
+		ts.numSubsystems = 0;
+		for (auto &part: systems) {
+			if (part->steadyState && !allSteady) {
+				part->unfoldHyperperiods();
+			}
+			ts.absorb(*part);
+			ts.timer.add(part->timer);
+		}
+		ts.steadyState = allSteady;
+		ts.timer.stop();
+		return ts;
+	}
+
+	// analyze the sub-models of the split (in parallel, each with the given analysis) and report the union of
+	// their completion times: every concrete schedule is a schedule of one of them (the policy does not read
+	// the split intervals, see uncertaintySplit)
+	template<class Analysis>
+	static transitionSystem
+	constructBySplitting(std::string segFile, jobSet jobs, events<Time> systemEvents,
+						 std::vector<processor> &processors, double timeout, tools::horizon<Time> horizon,
+						 const uncertaintySplit<Time> &split, Analysis analysis) {
+		std::vector<unsigned int> resourceSet = tools::generateResourceSet(processors);
+		auto ts = transitionSystem(jobs, systemEvents, processors, resourceSet, timeout);
+		log<LOG_DEBUG>("Constructing %1% transition systems, one per sub-model") % split.getNumSubmodels();
+		ts.jobFile = segFile;
+		ts.horizon = horizon;
+		ts.numSubmodels = split.getNumSubmodels();
+		ts.splitIntervals = split.describe();
+		ts.completed = true;
+		ts.timer.start();
+
+		ts.analyzeInParallel(split.getNumSubmodels(), [&](std::size_t i) { return split.submodel(i); }, analysis);
+		ts.timer.stop();
+		return ts;
+	}
+
+	// analyze the time windows (in parallel, each with the given analysis) from their boundary states, see
+	// timeWindows; a window is only analyzed correctly if no deadline is missed in the windows before it,
+	// so the response times are only sound if all windows are schedulable
+	template<class Analysis>
+	static transitionSystem
+	constructByWindow(std::string segFile, jobSet jobs, events<Time> systemEvents,
+					  std::vector<processor> &processors, double timeout, tools::horizon<Time> horizon,
+					  const timeWindows<Time> &windows, Analysis analysis) {
+		std::vector<unsigned int> resourceSet = tools::generateResourceSet(processors);
+		auto ts = transitionSystem(jobs, systemEvents, processors, resourceSet, timeout);
+		log<LOG_DEBUG>("Constructing %1% transition systems, one per time window") % windows.getNumWindows();
+		ts.jobFile = segFile;
+		ts.horizon = horizon;
+		ts.windowStarts = windows.getStarts();
+		ts.completed = true;
+		ts.timer.start();
+		ts.analyzeInParallel(windows.getNumWindows(), [&](std::size_t i) { return windows.window(i); }, analysis);
+		ts.timer.stop();
+		return ts;
+	}
+
+	// counterexample-guided refinement of the merging: the first pass merges as usual, and as long as a pass
+	// misses a deadline, the next one merges exactly in a larger region before the miss (see refineMerging)
+	static transitionSystem
+	constructRefined(std::string segFile, jobSet jobs, events<Time> systemEvents,
+					 std::vector<processor> &processors, double timeout, tools::horizon<Time> horizon = {},
+					 bool symmetry = false, bool partialOrder = false, bool falsify = false,
+					 std::vector<std::string> witnessJobs = {}) {
+		std::vector<unsigned int> resourceSet = tools::generateResourceSet(processors);
+		auto ts = transitionSystem(jobs, systemEvents, processors, resourceSet, timeout);
+		log<LOG_DEBUG>("Constructing transition system with refinement of the merging");
+		ts.jobFile = segFile;
+		ts.horizon = horizon;
+		if (symmetry)
+			ts.makeSymmetryClasses();
+		ts.partialOrderReduction = partialOrder;
+		ts.setFalsification(falsify);
+		ts.timer.start();
+
+		auto pass = refineMerging([&](const std::optional<mergeRegion> &region, double limit) {
+			auto p = std::make_unique<transitionSystem>(jobs, systemEvents, processors, resourceSet, limit);
+			p->horizon = horizon;
+			if (symmetry)
+				p->makeSymmetryClasses();
+			p->partialOrderReduction = partialOrder;
+			p->setFalsification(falsify);
+			p->setWitnessJobs(witnessJobs);
+			p->exactMerging = region;
+			p->timer.start();
+			p->construct();
+			p->timer.stop();
+			return p;
+		}, timeout);
+
+		ts.completed = true;
+		ts.numSubsystems = 0;
+		ts.absorb(*pass);
+		ts.steadyState = pass->steadyState;
+		ts.timer.stop();
+		return ts;
+	}
+
+	// result of a task set that was decided before the exploration (by an analytical test or a concrete
+	// schedule that misses a deadline), the response times of the jobs are not known
+	static transitionSystem
+	constructScreened(std::string segFile, jobSet jobs, events<Time> systemEvents,
+					  std::vector<processor> &processors, double timeout, bool schedulable, std::string method,
+					  const cpuTime &screeningTime) {
+		std::vector<unsigned int> resourceSet = tools::generateResourceSet(processors);
+		auto ts = transitionSystem(jobs, systemEvents, processors, resourceSet, timeout);
+		log<LOG_DEBUG>("Schedulability decided by %1%") % method;
+		ts.jobFile = segFile;
+		ts.completed = schedulable;
+		ts.aborted = !schedulable;
+		ts.method = method;
+		ts.screened = true;
+		ts.timer = screeningTime;
+		return ts;
+	}
+
+	// analysis of one point of a sensitivity search: the exploration stops at the first deadline miss,
+	// or as soon as the given flag is set (by a deadline miss of another analysis)
+	static transitionSystem
+	constructProbe(std::string segFile, jobSet jobs, events<Time> systemEvents, std::vector<processor> &processors,
+				   double timeout, std::shared_ptr<std::atomic<bool>> stop) {
+		std::vector<unsigned int> resourceSet = tools::generateResourceSet(processors);
+		auto ts = transitionSystem(jobs, systemEvents, processors, resourceSet, timeout);
+		ts.jobFile = segFile;
+		ts.setFalsification(true);
+		ts.missFound = stop;
+		ts.timer.start();
+		ts.construct();
+		ts.timer.stop();
+		return ts;
+	}
+
 	transitionSystem(const jobSet &workload, events<Time> systemEvents, std::vector<processor> &processors,
 					 std::vector<unsigned int> &resourceSet, double timeout)
 			: jobs(workload), numStates(0), timeout(timeout), systemEvents(systemEvents), processors(processors),
 			  resourceSet(resourceSet),
 			  numDispatchedJob(workload.size()),
-			  _jobsByWin(Interval<Time>{0, maxDeadline(workload)}, maxDeadline(workload) / workload.size()),
-			  jobsByWin(_jobsByWin) {
+			  _jobsByWin(Interval<Time>{0, maxDeadline(workload)}, bucketWidth(workload)),
+			  jobsByWin(_jobsByWin),
+			  exploreCombinations(processors.size()), peekCombinations(processors.size()),
+			  chainCombinations(processors.size()) {
 		for (const job<Time> &s: jobs) {
 			jobsByID.emplace(s.getID(), s);
 			jobRefsByID.emplace(s.getID(), &s);
 			_jobsByWin.insert(s);
 		}
+		if constexpr (policy::sortThenPick<scheduler<Time>>::value) {
+			exploreBatch = batchScheduler<Time>(scheduler<Time>::pickFront);
+			peekBatch = batchScheduler<Time>(scheduler<Time>::pickFront);
+		}
+		// sort-then-pick policies: keep the jobs of each bucket in the order of the policy,
+		// so that ready queues are built already sorted
+		classifier = jobClassifier<Time>(jobs, _jobsByWin, _jobsByWin.numBuckets(), processors.size(),
+										 [](const job<Time> &a, const job<Time> &b) {
+											 if constexpr (policy::sortThenPick<scheduler<Time>>::value) {
+												 return batchScheduler<Time>::before(scheduler<Time>::pickKey, a, b);
+											 }
+											 return false;
+										 });
+		// the classifier keeps the job indices of the buckets
+		_jobsByWin.releaseBuckets();
 		schedulingPolicy = scheduler<Time>(jobsByID);
+		if constexpr (timeIndependentPolicy) {
+			makeTimeline();
+		}
+	}
+
+	void setWitnessJobs(const std::vector<std::string> &labels) {
+		witnessJobs = labels;
+		if (!labels.empty() && !predecessors.open()) {
+			log<LOG_WARNING>("The predecessor log cannot be created, no witnesses are reported");
+		}
+	}
+
+	// store the frontiers in the given file (at most 64 checkpoints up to the latest deadline), and resume
+	// from the frontiers of an earlier exploration if the file holds some
+	void setFrontierFile(const std::string &fileName) {
+		frontierFile = fileName;
+		checkpointStep = std::max(maxDeadline(jobs) / 64, timeModel::constants<Time>::epsilon());
+		nextCheckpoint = checkpointStep;
+	}
+
+	void setFalsification(bool falsify) {
+		falsification = falsify;
+		if (falsify)
+			method = "Falsification";
+	}
+
+	// jobs with the same parameters (and task period) are interchangeable if the policy orders them next to each
+	// other: a sort-then-pick policy orders the jobs by its key and then by job ID, so a class ends wherever
+	// another job with the same key falls between its members (the jobs of other policies are not reduced)
+	void makeSymmetryClasses() {
+		if constexpr (!policy::sortThenPick<scheduler<Time>>::value) {
+			log<LOG_WARNING>("Symmetry reduction is only supported for sort-then-pick policies");
+		} else {
+			std::map<std::tuple<Time, Time, Time, Time, Time, unsigned int, Time, Time>, std::size_t> parameterClass;
+			std::vector<std::size_t> classByParameters(jobs.size());
+			for (std::size_t i = 0; i < jobs.size(); i++) {
+				const job<Time> &j = jobs[i];
+				auto key = std::make_tuple(j.getArrival().min(), j.getArrival().max(), j.getCost().min(),
+										   j.getCost().max(), j.getDeadline(), j.getAssignedProcessorSet(),
+										   j.getPriority(), j.getTaskPeriod());
+				classByParameters[i] = parameterClass.emplace(key, parameterClass.size()).first->second;
+			}
 
+			// consecutive jobs in the order of the policy with the same parameters form a class
+			std::vector<std::size_t> order(jobs.size());
+			for (std::size_t i = 0; i < jobs.size(); i++) {
+				order[i] = i;
+			}
+			std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+				return batchScheduler<Time>::before(scheduler<Time>::pickKey, jobs[a], jobs[b]);
+			});
+			classOf.resize(jobs.size());
+			for (std::size_t k = 0; k < order.size(); k++) {
+				if (k == 0 || classByParameters[order[k]] != classByParameters[order[k - 1]]) {
+					symmetryClasses.emplace_back();
+				}
+				symmetryClasses.back().push_back(order[k]);
+				classOf[order[k]] = symmetryClasses.size() - 1;
+			}
+			// the first undispatched job of a class is the one with the smallest index
+			for (auto &cls: symmetryClasses) {
+				std::sort(cls.begin(), cls.end());
+			}
+			symmetryReduction = symmetryClasses.size() < jobs.size();
+			log<LOG_INFO>("%1% symmetry classes for %2% jobs") % symmetryClasses.size() % jobs.size();
+		}
+	}
+
+	// the first undispatched job of the class of the given job
+	const job<Time> &canonicalJob(const state<Time> &s, const job<Time> &j) {
+		for (auto i: symmetryClasses[classOf[indexOf(j)]]) {
+			if (!s.isDispatched(i)) {
+				return jobs[i];
+			}
+		}
+		return j;
+	}
+
+	void makeTimeline() {
+		timeline.reserve(3 * jobs.size() + _jobsByWin.numBuckets());
+		for (const job<Time> &j: jobs) {
+			timeline.push_back(j.getArrival().min());
+			timeline.push_back(j.getArrival().max());
+			// a job misses its deadline if it starts strictly after its latest start time
+			Time latestStart = j.getDeadline() + timeModel::constants<Time>::deadlineMissTolerance()
+							   - j.getCost().max();
+			if constexpr (std::is_floating_point<Time>::value) {
+				timeline.push_back(std::nextafter(latestStart, timeModel::constants<Time>::infinity()));
+			} else {
+				timeline.push_back(latestStart + 1);
+			}
+		}
+		for (std::size_t b = 1; b < _jobsByWin.numBuckets(); b++) {
+			timeline.push_back(_jobsByWin.bucketStart(b));
+		}
+		std::sort(timeline.begin(), timeline.end());
+		timeline.erase(std::unique(timeline.begin(), timeline.end()), timeline.end());
 	}
 
 	void construct() {
-		makeInitialStates();
+		if (!resumeFromFrontier()) {
+			makeInitialStates();
+		}
 
 		do {
 
@@ -166,23 +708,285 @@ public:
 
 			//get the state
 			state<Time> &s = *(statesByID.find(sID)->second);
+			// the buckets behind the explored state are only done with if the states are explored by time stamp
+			if (falsification) {
+				slackOf.erase(sID);
+			} else {
+				classifier.retireBefore(jobsByWin.bucket_of(s.getTimeStamp()));
+			}
+
+			if (!frontierFile.empty() && s.getTimeStamp() >= nextCheckpoint) {
+				storeFrontier(s.getTimeStamp());
+			}
+
+			// stop once the frontier repeats at a hyperperiod boundary
+			if (horizon.numHyperperiods > 1 && frontierRepeats(s)) {
+				completed = true;
+				break;
+			}
 
 			//check the timeout
 			checkTimeout();
 
-			if (aborted)
+			if (aborted || (missFound && *missFound))
 				break;
 
 			exploreState(s);
 
 		} while (numDispatchedJob < jobs.size());
 
+		if (predecessors.isOpen()) {
+			extractWitnesses();
+		}
+		if (!frontierFile.empty()) {
+			saveFrontiers();
+		}
+	}
 
+	// store the unexplored states when the exploration first reaches a checkpoint
+	// (the leaves are all at or after the time stamp of the explored state)
+	void storeFrontier(Time timeStamp) {
+		typename frontierStore<Time>::snapshot sn;
+		sn.checkpoint = nextCheckpoint;
+		sn.numStates = numStates + numReusedStates;
+		for (std::size_t i = 0; i < jobs.size(); i++) {
+			auto rt = responseTimes.find(jobs[i].getID());
+			if (rt != responseTimes.end()) {
+				sn.completions.emplace_back(i, rt->second.min(), rt->second.max());
+			}
+		}
+		for (const auto &p: statesByID) {
+			const state<Time> &s = *p.second;
+			if (s.getNumberOfDispatchedJobs() == jobs.size()) {
+				continue;
+			}
+			typename frontierStore<Time>::storedState stored;
+			stored.timeStamp = s.getTimeStamp();
+			for (std::size_t i = 0; i < jobs.size(); i++) {
+				if (s.isDispatched(i)) {
+					stored.dispatched.push_back(i);
+				}
+			}
+			stored.availability = s.getProcessorAvailability();
+			stored.events = s.getEventSet();
+			lookahead = std::max(lookahead, s.getTimeStamp());
+			sn.states.push_back(std::move(stored));
+		}
+		sn.lookahead = lookahead;
+		frontiers.snapshots.push_back(std::move(sn));
+		nextCheckpoint = Time(std::floor(timeStamp / checkpointStep) + 1) * checkpointStep;
 	}
 
-	void makeInitialStates() {
-		// Estimate the number of states and preallocate memory accordingly.
-		statesByID.reserve(jobs.size() * 2);
+	// resume from the last stored frontier that the changes of the model cannot have influenced: the
+	// exploration up to it has only looked at times before the earliest release or deadline miss of a changed
+	// job and before the first changed event, so it is the same for both models
+	// (the stored frontiers up to it are kept), returns false if there is none
+	bool resumeFromFrontier() {
+		if (frontierFile.empty()) {
+			return false;
+		}
+		frontierStore<Time> stored;
+		if (!stored.load(frontierFile)) {
+			log<LOG_INFO>("No stored frontiers in %1%") % frontierFile;
+			return false;
+		}
+		if (stored.allEvents != systemEvents.isAllEvent() || stored.arrivalEvents != systemEvents.isArrivalEvent()
+			|| stored.completionEvents != systemEvents.isCompletionEvent() || stored.cores != resourceSet
+			|| stored.jobs.size() != jobs.size()) {
+			log<LOG_WARNING>("The stored frontiers belong to another system, exploring from the initial state");
+			return false;
+		}
+		if (stored.scheduler != policy::fingerprint<scheduler<Time>>::value) {
+			log<LOG_WARNING>("The stored frontiers belong to another scheduler, exploring from the initial state");
+			return false;
+		}
+		if (stored.timeScale != horizon.timeScale) {
+			log<LOG_WARNING>("The stored frontiers are in units of %1%, not %2%, exploring from the initial state")
+			% stored.timeScale % horizon.timeScale;
+			return false;
+		}
+
+		Time influence = timeModel::constants<Time>::infinity();
+		for (std::size_t i = 0; i < jobs.size(); i++) {
+			typename frontierStore<Time>::storedJob current(jobs[i]);
+			const auto &old = stored.jobs[i];
+			if (!current.sameJob(old)) {
+				log<LOG_WARNING>("The stored frontiers belong to another job set, exploring from the initial state");
+				return false;
+			}
+			if (current != old) {
+				influence = std::min(influence, influenceOf(old, current));
+			}
+		}
+		const std::set<Time> events = initialEvents();
+		std::vector<Time> removed, added;
+		std::set_difference(stored.initialEvents.begin(), stored.initialEvents.end(), events.begin(), events.end(),
+							std::back_inserter(removed));
+		std::set_difference(events.begin(), events.end(), stored.initialEvents.begin(), stored.initialEvents.end(),
+							std::back_inserter(added));
+		if (!removed.empty()) {
+			influence = std::min(influence, removed.front());
+		}
+		if (!added.empty()) {
+			influence = std::min(influence, added.front());
+		}
+
+		auto last = std::find_if(stored.snapshots.begin(), stored.snapshots.end(),
+								 [&](const auto &sn) { return sn.lookahead >= influence; });
+		if (last == stored.snapshots.begin()) {
+			log<LOG_INFO>("The changes influence the exploration from time %1%, no stored frontier is reused")
+			% influence;
+			return false;
+		}
+
+		// the changed events all lie after the lookahead, so they are initial events in the stored states
+		// (not completion events)
+		for (auto it = stored.snapshots.begin(); it != last; ++it) {
+			for (auto &st: it->states) {
+				for (auto e: removed) {
+					st.events.erase(e);
+				}
+				for (auto e: added) {
+					if (e > st.timeStamp) {
+						st.events.insert(e);
+					}
+				}
+			}
+			frontiers.snapshots.push_back(std::move(*it));
+		}
+
+		const auto &sn = frontiers.snapshots.back();
+		for (const auto &c: sn.completions) {
+			responseTimes.emplace(jobs[std::get<0>(c)].getID(), Interval<Time>(std::get<1>(c), std::get<2>(c)));
+		}
+		for (const auto &st: sn.states) {
+			std::vector<const job<Time> *> dispatchedJobs;
+			for (auto i: st.dispatched) {
+				dispatchedJobs.push_back(&jobs[i]);
+			}
+			auto s = std::make_unique<state<Time>>(numStates, st.timeStamp, dispatchedJobs, st.dispatched,
+													st.availability, st.events, systemEvents.isCompletionEvent());
+			transitionStructure.addNode(-1, s->getTimeStamp(), s->getStateLabel(), "");
+			predecessors.append(numStates, predecessorLog<Time>::noParent, s->getTimeStamp(), "");
+			statesByID.emplace(numStates, std::move(s));
+			pushExplorable(numStates);
+			numStates++;
+		}
+		numReusedStates = sn.numStates - numStates;
+		lookahead = sn.lookahead;
+		nextCheckpoint = sn.checkpoint + checkpointStep;
+		resumedAt = sn.checkpoint;
+		log<LOG_INFO>("Resuming from the frontier at %1% (%2% states)") % sn.checkpoint % sn.states.size();
+		return true;
+	}
+
+	// the earliest time at which the change of a job can influence the exploration
+	Time influenceOf(const typename frontierStore<Time>::storedJob &old,
+					 const typename frontierStore<Time>::storedJob &current) const {
+		// a policy that does not only sort the ready queue may read the parameters of any job
+		if constexpr (!policy::sortThenPick<scheduler<Time>>::value) {
+			return 0;
+		} else {
+			// deadline miss
+			Time influence = std::min(old.latestStart(), current.latestStart());
+			// release, cluster, or order in the ready queues
+			if (old.arrivalMin != current.arrivalMin || old.cluster != current.cluster
+				|| batchScheduler<Time>::keyOf(scheduler<Time>::pickKey, old.toJob())
+				   != batchScheduler<Time>::keyOf(scheduler<Time>::pickKey, current.toJob())) {
+				influence = std::min({influence, old.arrivalMin, current.arrivalMin});
+			}
+			// certain release
+			if (old.arrivalMax != current.arrivalMax) {
+				influence = std::min({influence, old.arrivalMax, current.arrivalMax});
+			}
+			// completion times (the execution time only matters once the job is dispatched)
+			if ((old.costMin != current.costMin || old.costMax != current.costMax) && old.earliestStart >= 0) {
+				influence = std::min(influence, old.earliestStart);
+			}
+			return influence;
+		}
+	}
+
+	void saveFrontiers() {
+		frontiers.scheduler = policy::fingerprint<scheduler<Time>>::value;
+		frontiers.timeScale = horizon.timeScale;
+		frontiers.allEvents = systemEvents.isAllEvent();
+		frontiers.arrivalEvents = systemEvents.isArrivalEvent();
+		frontiers.completionEvents = systemEvents.isCompletionEvent();
+		frontiers.cores = resourceSet;
+		frontiers.jobs.clear();
+		for (const auto &j: jobs) {
+			frontiers.jobs.emplace_back(j);
+			auto rt = responseTimes.find(j.getID());
+			if (rt != responseTimes.end()) {
+				frontiers.jobs.back().earliestStart = rt->second.min() - j.getCost().min();
+			}
+		}
+		frontiers.initialEvents = initialEvents();
+		if (!frontiers.save(frontierFile)) {
+			log<LOG_WARNING>("The frontiers cannot be stored in %1%") % frontierFile;
+		}
+	}
+
+	// check the frontier when the exploration crosses a hyperperiod boundary (s is the explorable state
+	// with the smallest time stamp, so all leaves are at or after the boundary)
+	// the exploration has reached a steady state if every state of the frontier, shifted by one hyperperiod,
+	// is also a state of the frontier at the previous boundary: the rest of the exploration repeats
+	bool frontierRepeats(const state<Time> &s) {
+		auto k = (long long) std::floor(s.getTimeStamp() / horizon.hyperperiod);
+		if (k <= lastBoundary) {
+			return false;
+		}
+
+		std::vector<frontierState> frontier;
+		for (const auto &p: statesByID) {
+			if (p.second->getNumberOfDispatchedJobs() < jobs.size()) {
+				frontier.emplace_back(relativeTo(*p.second, k));
+			}
+		}
+		std::sort(frontier.begin(), frontier.end());
+		frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+
+		// the events of the next hyperperiod are only generated up to the last hyperperiod
+		bool repeats = lastBoundary == k - 1 && k + 1 < horizon.numHyperperiods
+					   && std::includes(lastFrontier.begin(), lastFrontier.end(), frontier.begin(), frontier.end());
+		log<LOG_INFO>("Frontier at hyperperiod %1%: %2% states") % k % frontier.size();
+		lastFrontier = std::move(frontier);
+		lastBoundary = k;
+		steadyState = repeats;
+		return repeats;
+	}
+
+	frontierState relativeTo(const state<Time> &s, long long k) const {
+		const Time boundary = horizon.hyperperiod * k;
+		const auto offset = (long long) (horizon.jobsPerHyperperiod * k);
+		frontierState fs;
+		fs.timeStamp = s.getTimeStamp() - boundary;
+		for (long long i = 0; i < (long long) jobs.size(); i++) {
+			if (i < offset && !s.isDispatched(i)) {
+				fs.carryIn.push_back(i - offset);
+			} else if (i >= offset && s.isDispatched(i)) {
+				fs.ahead.push_back(i - offset);
+			}
+		}
+		// availability bounds before the time stamp all mean that the core is free
+		for (const auto &cluster: s.getProcessorAvailability()) {
+			for (const auto &a: cluster) {
+				fs.availability.push_back(std::max(a.min(), s.getTimeStamp()) - boundary);
+				fs.availability.push_back(std::max(a.max(), s.getTimeStamp()) - boundary);
+			}
+		}
+		for (const auto &e: s.getEventSet()) {
+			if (e - boundary >= horizon.hyperperiod) {
+				break;
+			}
+			fs.events.push_back(e - boundary);
+		}
+		return fs;
+	}
+
+	// the event set of the initial state
+	std::set<Time> initialEvents() const {
 		// use a set to avoid duplicate event times
 		std::set<Time> eventTimes;
 		if (systemEvents.isAllEvent()) {
@@ -206,131 +1010,248 @@ public:
 			}
 
 		}
+		return eventTimes;
+	}
 
-		auto s = std::make_unique<state<Time>>(resourceSet, eventTimes, systemEvents.isCompletionEvent());
+	void makeInitialStates() {
+		// Estimate the number of states and preallocate memory accordingly.
+		statesByID.reserve(jobs.size() * 2);
+
+		auto s = std::make_unique<state<Time>>(resourceSet, initialEvents(), systemEvents.isCompletionEvent());
 		transitionStructure.addNode(-1, s->getTimeStamp(), s->getStateLabel(), "");
+		predecessors.append(numStates, predecessorLog<Time>::noParent, s->getTimeStamp(), "");
 		statesByID.emplace(numStates, std::move(s));
-		explorableStates.push(numStates);
+		pushExplorable(numStates);
 		numStates++;
 	}
 
 	// explore a state for possible transitions
 	void exploreState(const state<Time> &s) {
 		log<LOG_INFO>("Checking state %1%") % s;
-		readyQueues queues = makeReadyQueues(s);
+		witnessState = s.getStateID();
+		// reuse the classification derived from the parent if there is one
+		auto pending = pendingClassifications.find(s.getStateID());
+		if (pending != pendingClassifications.end() && pending->second.timeStamp == s.getTimeStamp()) {
+			exploreClassification = std::move(pending->second);
+		} else {
+			classifier.classify(jobsByWin.bucket_of(s.getTimeStamp()), s, exploreClassification);
+		}
+		if (pending != pendingClassifications.end()) {
+			pendingClassifications.erase(pending);
+		}
+		readyQueue candidates;
+		readyQueues queues = makeReadyQueues(exploreClassification, exploreReady, &candidates);
+		if (falsification && aborted) {
+			return;
+		}
+
+		// sort-then-pick policies: select the jobs of all ready queues in one batch
+		if constexpr (policy::sortThenPick<scheduler<Time>>::value) {
+			if (exploreBatch.decide(queues, candidates)) {
+				// copy the decisions, peeking evaluates other batches
+				auto selectedJobs = exploreBatch.getDecisions();
+				for (std::size_t q = 0; q < selectedJobs.size(); q++) {
+					applyDecision(s, queues, candidates, selectedJobs[q], &queues[q]);
+				}
+				return;
+			}
+		}
+
 		for (const auto &q: queues) {
 			// convert the vector of job IDs to an actual queue
 			auto rq = queue<Time>(jobsByID, q);
-#ifdef RESOURCE_ACCESS
-			// make available resource set based on the selected ready queue
-			auto rangeOfAvailableResources = makeAvailableResourcesMap(rq, s);
-			auto allAvailableResourcesCombinations = makeAllCombinationsOfAvailableResources(rangeOfAvailableResources);
-			for (auto availableResources: allAvailableResourcesCombinations) {
+			// make the range of available resources based on the selected ready queue
+			// (a single combination if the policy has no access to the available resources)
+			makeAvailableResources(rq, s, s.getTimeStamp(), exploreCombinations);
+			do {
 				// call scheduler to select a job based on the scheduling policy from the possible ready queues
-				auto selectedJob = schedulingPolicy.callScheduler(rq, availableResources, s.getTimeStamp());
-
-				if (selectedJob == std::nullopt) {
-					log<LOG_INFO>("No job is selected from the ready queue");
-					// we have to do a time transition
-					// get the next event time
-					if (transitionStructure.hasEdge(s.getStateID(),
-													std::to_string(s.getNextEventTime() - s.getTimeStamp()))) {
-						log<LOG_INFO>("Time transition already exists");
-						continue;
-					} else {
-						auto nextEventTime = s.getNextEventTime();
-						if (!beNaive) {
-							// if we are not in naive mode,
-							// we apply the peeking strategy to implement scheduling event abstraction
-							// create a temp copy of the state to avoid modifying the original state
-							state<Time> tempState(s);
-							nextEventTime = peekState(queues, tempState);
-						}
-						timeTransition(s, nextEventTime);
-					}
-				} else {
-					auto selectedJobID = selectedJob.value();
-					// we have a job to dispatch
-					// we need to check if the job is already dispatched
-					if (transitionStructure.hasEdge(s.getStateID(), selectedJobID.string())) {
-						log<LOG_INFO>("The transition already proceeded");
-						continue;
-					} else {
-						// we have a new dispatch transition
-						dispatchJob(s, selectedJobID);
-					}
-				}
-			}
-#else
-			// call scheduler to select a job based on the scheduling policy from the possible ready queues
-			// we do not need to consider the available resources in this case, so we pass an empty map
-			auto selectedJob = schedulingPolicy.callScheduler(rq, {}, s.getTimeStamp());
+				auto selectedJob = callScheduler(rq, exploreCombinations.get(), s.getTimeStamp());
+				applyDecision(s, queues, candidates, selectedJob, &q);
+			} while (exploreCombinations.next());
+		}
 
-			if (selectedJob == std::nullopt) {
-				log<LOG_INFO>("No job is selected from the ready queue");
-				// we have to do a time transition
-				// get the next event time
-				if (transitionStructure.hasEdge(s.getStateID(),
-												std::to_string(s.getNextEventTime() - s.getTimeStamp()))) {
-					log<LOG_INFO>("Time transition already exists");
-					continue;
-				} else {
-					auto nextEventTime = s.getNextEventTime();
-					if (!beNaive) {
-						// if we are not in naive mode,
-						// we apply the peeking strategy to implement scheduling event abstraction
-						state<Time> tempState(s);
-						nextEventTime = peekState(queues, tempState);
+	}
+
+	// make the transition that follows from a decision of the scheduler
+	// (selectedFrom: the ready queue of the decision, if it is known)
+	void applyDecision(const state<Time> &s, const readyQueues &queues, const readyQueue &candidates,
+					   const std::optional<jobID> &selectedJob, const readyQueue *selectedFrom = nullptr) {
+		if (selectedJob == std::nullopt) {
+			log<LOG_INFO>("No job is selected from the ready queue");
+			// we have to do a time transition
+			// get the next event time
+			if (transitionStructure.hasEdge(s.getStateID(),
+											std::to_string(s.getNextEventTime() - s.getTimeStamp()))) {
+				log<LOG_INFO>("Time transition already exists");
+			} else {
+				auto nextEventTime = s.getNextEventTime();
+				if (!beNaive) {
+					// if we are not in naive mode,
+					// we apply the peeking strategy to implement scheduling event abstraction
+					// (states with the same dispatched jobs, availability and events peek the same time)
+					auto hash = peekCache<Time>::hashOf(s);
+					auto nextEvent = [this](const state<Time> &st, Time t) { return nextPeekedEvent(st, t); };
+					if (!peeks.lookup(hash, s, nextEventTime, nextEvent)) {
+						nextEventTime = peekState(queues, candidates, s);
+						peeks.store(hash, s, nextEventTime, peekSteps);
 					}
-					timeTransition(s, nextEventTime);
 				}
+				timeTransition(s, nextEventTime);
+			}
+		} else {
+			auto selectedJobID = selectedJob.value();
+			// we have a job to dispatch
+			// we need to check if the job is already dispatched
+			// (with partial-order reduction, the transition is only known once its chain is made)
+			bool chain = partialOrderReduction && !beNaive && selectedFrom != nullptr;
+			if (!chain && transitionStructure.hasEdge(s.getStateID(), selectedJobID.string())) {
+				log<LOG_INFO>("The transition already proceeded");
 			} else {
-				auto selectedJobID = selectedJob.value();
-				// we have a job to dispatch
-				// we need to check if the job is already dispatched
-				if (transitionStructure.hasEdge(s.getStateID(), selectedJobID.string())) {
-					log<LOG_INFO>("The transition already proceeded");
-					continue;
-				} else {
-					// we have a new dispatch transition
-					dispatchJob(s, selectedJobID);
-				}
+				// we have a new dispatch transition
+				dispatchJob(s, selectedJobID, selectedFrom);
 			}
-#endif
-
-
 		}
-
 	}
 
-	void dispatchJob(const state<Time> &s, jobID sid) {
+	void dispatchJob(const state<Time> &s, jobID sid, const readyQueue *selectedFrom = nullptr) {
 		log<LOG_INFO>("Dispatching job %1%") % sid;
 		// get the job from the job ID
-		const job<Time> &job = *(jobRefsByID.find(sid)->second);
+		const job<Time> *selected = jobRefsByID.find(sid)->second;
+		bool redirected = false;
+		if (symmetryReduction) {
+			const job<Time> &canonical = canonicalJob(s, *selected);
+			if (&canonical != selected) {
+				redirected = true;
+				selected = &canonical;
+				sid = canonical.getID();
+			}
+		}
+		const job<Time> &job = *selected;
 		//calculate the earliest and latest finish time of the job
 		Interval<Time> ftimes = job.getCost() + s.getTimeStamp();
-
-		auto newState = std::make_unique<state<Time>>(s, numStates, job, indexOf(job), job.getAssignedProcessorSet(), ftimes);
+		lookahead = std::max(lookahead, ftimes.max());
+
+		bool earliestCompletion = isRelevantCompletion(s, job, ftimes.min());
+		bool latestCompletion = isRelevantCompletion(s, job, ftimes.max());
+		auto newState = std::make_unique<state<Time>>(s, numStates, job, indexOf(job), job.getAssignedProcessorSet(),
+													  ftimes, earliestCompletion, latestCompletion);
+		std::string label = sid.string();
+		bool chained = false;
+		if (!beNaive && partialOrderReduction && selectedFrom != nullptr) {
+			classifier.dispatched(exploreClassification, *newState, indexOf(job), job.getAssignedProcessorSet(),
+								  chainClassification);
+			chained = dispatchChain(newState, *selectedFrom, label, s.getStateID());
+			if (transitionStructure.hasEdge(s.getStateID(), label)) {
+				log<LOG_INFO>("The transition already proceeded");
+				return;
+			}
+		}
 		if (!beNaive) {
-			if (tryToMergeStates(*newState, s.getStateID(), sid.string())) {
-				updateResponseTime(sid, ftimes);
+			if (tryToMergeStates(*newState, s.getStateID(), label)) {
+				if (redirected)
+					numSymmetricMerges++;
+				updateResponseTime(sid, ftimes, s.getStateID(), label);
 				return;
 			}
 		}
 		log<LOG_INFO>("New state is created");
-		transitionStructure.addNode(s.getStateID(), newState->getTimeStamp(), newState->getStateLabel(),
-									sid.string());
+		transitionStructure.addNode(s.getStateID(), newState->getTimeStamp(), newState->getStateLabel(), label);
+		predecessors.append(numStates, s.getStateID(), newState->getTimeStamp(), label);
 		auto stateDispatchedJob = newState->getNumberOfDispatchedJobs();
-		statesByID.emplace(numStates, std::move(newState));
 		// if the number of dispatched jobs is lower than the number of jobs, we need to explore the new state later
+		// (with the classification derived from the explored state)
+		if (stateDispatchedJob < jobs.size()) {
+			if (chained) {
+				pendingClassifications[numStates] = chainClassification;
+			} else {
+				classifier.dispatched(exploreClassification, *newState, indexOf(job), job.getAssignedProcessorSet(),
+									  pendingClassifications[numStates]);
+			}
+		}
+		statesByID.emplace(numStates, std::move(newState));
 		if (stateDispatchedJob < jobs.size())
-			explorableStates.push(numStates);
+			pushExplorable(numStates);
 		numStates++;
 
-		updateResponseTime(sid, ftimes);
+		updateResponseTime(sid, ftimes, s.getStateID(), label);
 
 	}
 
+	// dispatch the jobs that the scheduler selects from the rest of the given ready queue in the new state
+	// (classified in chainClassification), returns true if at least one job was dispatched
+	// the chain stops when the policy selects no job, a job whose core is not certainly free, or different jobs
+	// for different numbers of available cores; the new state is then explored as usual
+	bool dispatchChain(std::unique_ptr<state<Time>> &newState, const readyQueue &selectedFrom, std::string &label,
+					   stateID from) {
+		readyQueue rest = selectedFrom;
+		bool chained = false;
+		while (!aborted) {
+			const Time ts = newState->getTimeStamp();
+			// drop the dispatched jobs and the jobs whose cluster is busy at this time stamp
+			bool uncertain = false;
+			rest.erase(std::remove_if(rest.begin(), rest.end(), [&](const jobID &id) {
+				const job<Time> &j = *jobRefsByID.find(id)->second;
+				if (newState->isDispatched(indexOf(j))) {
+					return true;
+				}
+				auto availability = newState->getProcessorAvailability(j.getAssignedProcessorSet(), 1);
+				uncertain |= availability.min() <= ts && ts < availability.max();
+				return availability.min() > ts;
+			}), rest.end());
+			if (uncertain || rest.empty()) {
+				break;
+			}
+
+			auto rq = queue<Time>(jobsByID, rest);
+			makeAvailableResources(rq, *newState, ts, chainCombinations);
+			auto selectedJob = callScheduler(rq, chainCombinations.get(), ts);
+			while (selectedJob != std::nullopt && chainCombinations.next()) {
+				if (!(callScheduler(rq, chainCombinations.get(), ts) == selectedJob)) {
+					selectedJob = std::nullopt;
+				}
+			}
+			if (selectedJob == std::nullopt) {
+				break;
+			}
+
+			const job<Time> *next = jobRefsByID.find(selectedJob.value())->second;
+			if (symmetryReduction) {
+				next = &canonicalJob(*newState, *next);
+			}
+			Interval<Time> ftimes = next->getCost() + ts;
+			lookahead = std::max(lookahead, ftimes.max());
+			bool earliestCompletion = isRelevantCompletion(*newState, *next, ftimes.min());
+			bool latestCompletion = isRelevantCompletion(*newState, *next, ftimes.max());
+			auto nextState = std::make_unique<state<Time>>(*newState, numStates, *next, indexOf(*next),
+														   next->getAssignedProcessorSet(), ftimes,
+														   earliestCompletion, latestCompletion);
+			classifier.dispatched(chainClassification, *nextState, indexOf(*next), next->getAssignedProcessorSet(),
+								  nextChainClassification);
+			std::swap(chainClassification, nextChainClassification);
+			newState = std::move(nextState);
+			label += "," + next->getID().string();
+			updateResponseTime(next->getID(), ftimes, from, label);
+			numChainedDispatches++;
+			chained = true;
+		}
+		return chained;
+	}
+
+	// a completion event only changes the availability of the cluster of the job, so it cannot change a decision
+	// if no other job of that cluster may be pending at that time; releases are events themselves,
+	// so later arrivals on the cluster are still observed
+	bool isRelevantCompletion(const state<Time> &s, const job<Time> &j, Time t) {
+		if constexpr (completionPruning) {
+			if (!beNaive && systemEvents.isCompletionEvent()
+				&& (systemEvents.isArrivalEvent() || systemEvents.isAllEvent())
+				&& !classifier.mayBePending(jobsByWin.bucket_of(t), j.getAssignedProcessorSet(), t, s, indexOf(j))) {
+				numPrunedEvents++;
+				return false;
+			}
+		}
+		return true;
+	}
+
 	void timeTransition(const state<Time> &s, Time nextEventTime) {
 		// check if the time transition already exists
 		if (transitionStructure.hasEdge(s.getStateID(),
@@ -350,11 +1271,12 @@ public:
 
 		transitionStructure.addNode(s.getStateID(), newState->getTimeStamp(), newState->getStateLabel(),
 									std::to_string(nextEventTime - s.getTimeStamp()));
+		predecessors.append(numStates, s.getStateID(), newState->getTimeStamp(), "");
 		auto stateDispatchedJob = newState->getNumberOfDispatchedJobs();
 		statesByID.emplace(numStates, std::move(newState));
 		// if the number of dispatched jobs is lower than the number of jobs, we need to explore the new state later
 		if (stateDispatchedJob < jobs.size())
-			explorableStates.push(numStates);
+			pushExplorable(numStates);
 		numStates++;
 
 
@@ -367,8 +1289,13 @@ public:
 		for (const auto &id: leaves) {
 			// check if the state can be merged with any of the leaf states
 			auto it = statesByID.find(id);
-			if (it != statesByID.end() && it->second->tryToMerge(s)) {
-				// we have merged the states
+			if (it != statesByID.end() && (!mergesExactlyAt(s) || it->second->mergesExactly(s, exactMerging->clusters))
+				&& it->second->tryToMerge(s)) {
+				// we have merged the states, the availability of the existing state may have changed
+				auto pending = pendingClassifications.find(it->first);
+				if (pending != pendingClassifications.end()) {
+					classifier.availabilityChanged(*it->second, pending->second);
+				}
 				// we need to update the transition structure
 				transitionStructure.updateNodeLabel(it->second->getStateID(), it->second->getStateLabel());
 				// make a new edge from the parent of s to the existing state
@@ -380,61 +1307,141 @@ public:
 		return false;
 	}
 
-	Time peekState(const readyQueues &queues, state<Time> &fromState) {
+	// the state has to be merged exactly
+	bool mergesExactlyAt(const state<Time> &s) const {
+		return exactMerging && exactMerging->times.contains(s.getTimeStamp());
+	}
+
+	Time peekState(const readyQueues &queues, const readyQueue &candidates, const state<Time> &fromState) {
 		// take a quick look at the next state to see if it makes different ready queues or dispatches a different job
 		// if it does, we need to create a new state
 		// otherwise, we can ignore it
+		// the state is not modified: the peeked time only advances the time at which the jobs are classified
 
 		// 1. found all the jobs that will be dispatched by the current ready queues
 		std::unordered_set<jobID> dispatchedJobs;
 		// reserve memory for the dispatched jobs
 		dispatchedJobs.reserve(jobs.size());
-		for (const auto &q: queues) {
-			auto rq = queue<Time>(jobsByID, q);
-			auto rangeOfAvailableResources = makeAvailableResourcesMap(rq, fromState);
-			auto allAvailableResourcesCombinations = makeAllCombinationsOfAvailableResources(
-					rangeOfAvailableResources);
-			for (const auto &availableResources: allAvailableResourcesCombinations) {
-				auto selectedJob = schedulingPolicy.callScheduler(rq, availableResources, fromState.getTimeStamp());
-				if (selectedJob != std::nullopt) {
-					dispatchedJobs.emplace(selectedJob.value());
-				}
-			}
-		}
+		collectSelectedJobs(queues, candidates, fromState, fromState.getTimeStamp(), dispatchedJobs);
 
+		Time peekedTime = fromState.getTimeStamp();
+		witnessState = fromState.getStateID();
+		peekSteps.clear();
 		while (true) {
+			auto nextEventTime = nextPeekedEvent(fromState, peekedTime);
+			peekSteps.push_back(nextEventTime);
+			if (nextEventTime == timeModel::constants<Time>::infinity()) {
+				// no later event
+				return peekedTime;
+			}
 
-			log<LOG_INFO>(">> Peeking the next state in time %1%") % (fromState.getNextEventTime());
+			log<LOG_INFO>(">> Peeking the next state in time %1%") % nextEventTime;
 			log<LOG_INFO>("-------------------------");
 
-			// update the time stamp of the current state
-			auto nextEventTime = fromState.getNextEventTime();
-			fromState.updateEventSet(nextEventTime);
-			readyQueues nextStateQueues = makeReadyQueues(fromState);
+			peekedTime = nextEventTime;
+			classifier.classify(jobsByWin.bucket_of(peekedTime), fromState, peekedTime, peekClassification);
+			readyQueue nextCandidates;
+			readyQueues nextStateQueues = makeReadyQueues(peekClassification, peekReady, &nextCandidates);
+			if (falsification && aborted) {
+				return peekedTime;
+			}
 
 			// 2. found all the jobs that will be dispatched by the next ready queues
 			std::unordered_set<jobID> nextDispatchedJobs;
 			// reserve memory for the dispatched jobs
 			nextDispatchedJobs.reserve(jobs.size());
-			for (const auto &q: nextStateQueues) {
-				auto rq = queue<Time>(jobsByID, q);
-				auto rangeOfAvailableResources = makeAvailableResourcesMap(rq, fromState);
-				auto allAvailableResourcesCombinations = makeAllCombinationsOfAvailableResources(
-						rangeOfAvailableResources);
-				for (const auto &availableResources: allAvailableResourcesCombinations) {
-					auto selectedJob = schedulingPolicy.callScheduler(rq, availableResources, fromState.getTimeStamp());
+			collectSelectedJobs(nextStateQueues, nextCandidates, fromState, peekedTime, nextDispatchedJobs);
+
+			// 3. compare the two sets of dispatched jobs and the ready queues
+			// (the fast path only makes the queues that decide, so it compares the ready jobs instead;
+			// exploreReady belongs to the peeked state)
+			bool sameQueues = fixedPriorityFastPath ? peekReady == exploreReady : nextStateQueues == queues;
+			if (nextDispatchedJobs != dispatchedJobs || !sameQueues) {
+				log<LOG_INFO>("-------------------------");
+				return peekedTime;
+			}
+		}
+	}
+
+	// the event of the state that a peek at the given time moves to next (infinity if there is none)
+	// these are the only events that a peek reads, the peek cache replays them to verify a hit
+	Time nextPeekedEvent(const state<Time> &s, Time peekedTime) const {
+		auto nextEventTime = timeModel::constants<Time>::infinity();
+		if constexpr (timeIndependentPolicy) {
+			// the ready queues and the decisions cannot change before the next change point,
+			// jump to the first event at or after it
+			nextEventTime = s.getEventFrom(nextChangePoint(s, peekedTime));
+		}
+		if (nextEventTime == timeModel::constants<Time>::infinity()) {
+			nextEventTime = s.getEventAfter(peekedTime);
+		}
+		return nextEventTime;
+	}
+
+	// the first time after the given time at which the classification of a job or the number of available
+	// cores of the state can change: the next point of the timeline or the next bound of a core's availability
+	Time nextChangePoint(const state<Time> &s, Time time) const {
+		auto it = std::upper_bound(timeline.begin(), timeline.end(), time);
+		Time next = it == timeline.end() ? timeModel::constants<Time>::infinity() : *it;
+		for (std::size_t c = 0; c < processors.size(); c++) {
+			for (unsigned int i = 1; i <= processors[c].getNumCores(); i++) {
+				auto availability = s.getProcessorAvailability(c, i);
+				if (availability.min() > time) {
+					next = std::min(next, availability.min());
+				}
+				if (availability.max() > time) {
+					next = std::min(next, availability.max());
+				}
+			}
+		}
+		return next;
+	}
+
+	// collect all jobs that the policy may select from the given ready queues
+	void collectSelectedJobs(const readyQueues &queues, const readyQueue &candidates, const state<Time> &s,
+							 Time time, std::unordered_set<jobID> &selectedJobs) {
+		if constexpr (policy::sortThenPick<scheduler<Time>>::value) {
+			if (peekBatch.decide(queues, candidates)) {
+				for (const auto &selectedJob: peekBatch.getDecisions()) {
 					if (selectedJob != std::nullopt) {
-						nextDispatchedJobs.emplace(selectedJob.value());
+						selectedJobs.emplace(selectedJob.value());
 					}
 				}
+				return;
 			}
+		}
+		for (const auto &q: queues) {
+			auto rq = queue<Time>(jobsByID, q);
+			makeAvailableResources(rq, s, time, peekCombinations);
+			do {
+				auto selectedJob = callScheduler(rq, peekCombinations.get(), time);
+				if (selectedJob != std::nullopt) {
+					selectedJobs.emplace(selectedJob.value());
+				}
+			} while (peekCombinations.next());
+		}
+	}
 
-			// 3. compare the two sets of dispatched jobs
-			if (nextDispatchedJobs != dispatchedJobs || nextStateQueues != queues) {
-				log<LOG_INFO>("-------------------------");
-				return fromState.getTimeStamp();
-			}
+	// call the scheduler through the decision cache
+	std::optional<jobID> callScheduler(queue<Time> &rq, const std::vector<unsigned int> &availableResources,
+									   Time currentTime) {
+		// resource counts are only part of the key if the policy reads them
+		static const std::vector<unsigned int> noResources;
+		const auto &resources = policy::readsAvailableResources<scheduler<Time>>::value ? availableResources
+																						: noResources;
+		// time-independent policies make the same decision at any time stamp
+		Time keyTime = policy::readsCurrentTime<scheduler<Time>>::value ? currentTime : Time(0);
+		auto hash = decisionCache<Time>::hashOf(rq.elements, resources, keyTime);
+
+		std::optional<jobID> selectedJob;
+		if (decisions->lookup(hash, rq.elements, resources, keyTime, selectedJob)) {
+			return selectedJob;
 		}
+		// keep the key before the policy reorders the queue
+		std::vector<jobID> queueKey = rq.elements;
+		selectedJob = schedulingPolicy.callScheduler(rq, availableResources, currentTime);
+		decisions->store(hash, queueKey, resources, keyTime, selectedJob);
+		return selectedJob;
 	}
 
 	// update number of dispatched jobs
@@ -447,78 +1454,121 @@ public:
 	}
 
 	// update the response time of the job
-	void updateResponseTime(jobID sid, Interval<Time> rt) {
-		auto it = responseTimes.find(sid);
-		if (it == responseTimes.end()) {
-			responseTimes.emplace(sid, rt);
-		} else {
-			it->second |= rt;
+	// (from: the state the job was dispatched in, together with the jobs of the transition)
+	void updateResponseTime(jobID sid, Interval<Time> rt, stateID from, const std::string &dispatched) {
+		if (!falsification) {
+			auto it = responseTimes.find(sid);
+			if (it == responseTimes.end() || rt.max() > it->second.max()) {
+				if (predecessors.isOpen()) {
+					completionSources.insert_or_assign(sid, witnessSource{sid, from, dispatched, rt.max()});
+				}
+			}
+			if (it == responseTimes.end()) {
+				responseTimes.emplace(sid, rt);
+			} else {
+				it->second |= rt;
+			}
 		}
 
 		if (jobsByID.find(sid)->second.exceedsDeadline(rt.upto())) {
 			log<LOG_WARNING>("Job %1% exceeds deadline") % sid;
-			aborted = true;
+			deadlineMissed(witnessSource{sid, from, dispatched, rt.upto()});
+		}
+	}
+
+	void deadlineMissed(const witnessSource &source) {
+		aborted = true;
+		if (missFound) {
+			*missFound = true;
+		}
+		// (the first miss also bounds the exact merging of the next pass of a refinement)
+		if (!missSource) {
+			missSource = source;
+		}
+	}
+
+	// add a state to the explorable states
+	// (in falsification mode with its slack: the least time by which an undispatched job of its bucket can start
+	// later, if it is released as late as possible and its cluster becomes free as late as possible)
+	void pushExplorable(stateID id) {
+		if (falsification) {
+			const state<Time> &s = *statesByID.find(id)->second;
+			const auto &bk = classifier.lookup(jobsByWin.bucket_of(s.getTimeStamp()));
+			Time slack = timeModel::constants<Time>::infinity();
+			for (std::size_t i = 0; i < bk.size(); i++) {
+				if (!s.isDispatched(bk.index[i])) {
+					Time start = std::max({s.getTimeStamp(), bk.arrivalMax[i],
+										   s.getProcessorAvailability(bk.cluster[i], 1).max()});
+					slack = std::min(slack, bk.latestStart[i] - start);
+				}
+			}
+			slackOf[id] = slack;
 		}
+		explorableStates.push(id);
 	}
 
-	readyQueues makeReadyQueues(const state<Time> &s) {
+	// make all possible ready queues of a classified state
+	// ready: the ready jobs of the state by certainty
+	// candidates (optional): all jobs that appear in at least one of the ready queues, in bucket order
+	readyQueues makeReadyQueues(const classification &cl, readyJobs &ready, readyQueue *candidates = nullptr) {
 		readyQueues queues;
-		readyQueue possibleReadyJobs;
-		readyQueue certainReadyJobs;
-		readyQueue certainReleasedJobs;
-		readyQueue allReadyJobs;
-
-		allReadyJobs.reserve(jobs.size());
-		certainReadyJobs.reserve(jobs.size());
-		certainReleasedJobs.reserve(jobs.size());
-		possibleReadyJobs.reserve(jobs.size());
-
-		for (const job<Time> &seg: jobsByWin.lookup(s.getTimeStamp())) {
-			// check if the job is already dispatched
-			log<LOG_DEBUG>("Checking job %1%") % seg.getID();
-			if (s.isDispatched(indexOf(seg))) {
-				log<LOG_DEBUG>(" -> Job %1% is already dispatched") % seg.getID();
+		readyQueue &possibleReadyJobs = ready.possible;
+		readyQueue &certainReadyJobs = ready.certain;
+		readyQueue &certainReleasedJobs = ready.released;
+		possibleReadyJobs.clear();
+		certainReadyJobs.clear();
+		certainReleasedJobs.clear();
+		// ready jobs in bucket order with their certainty (fast path only)
+		std::vector<std::pair<jobID, readiness>> ordered;
+
+		typedef jobClassifier<Time> jc;
+		const auto &bk = classifier.lookup(cl.bucket);
+		const auto &flags = cl.flags;
+
+		for (std::size_t i = 0; i < bk.size(); i++) {
+			auto f = flags[i];
+			// skip dispatched jobs and jobs that are not released yet
+			if (f & jc::DISPATCHED) {
 				continue;
-			} else if (seg.exceedsDeadline(s.getTimeStamp() + seg.getCost().max())) {
-				log<LOG_DEBUG>(" -> Job %1% missed its deadline") % seg.getID();
-				aborted = true;
 			}
-
-			// check if job is possibly released
-			if (s.getTimeStamp() >= seg.getArrival().from()) {
-				// check if the processor is available
-				if (s.getProcessorAvailability(seg.getAssignedProcessorSet(), 1).min() <= s.getTimeStamp()) {
-					allReadyJobs.emplace_back(seg.getID());
-				} else {
-					log<LOG_DEBUG>(" -> Job %1%'s resource is not available") % seg.getID();
+			if (f & jc::MISSES_DEADLINE) {
+				log<LOG_DEBUG>(" -> Job %1% missed its deadline") % bk.id[i];
+				deadlineMissed(witnessSource{bk.id[i], witnessState, "", cl.timeStamp});
+				if (falsification) {
+					return queues;
 				}
-			} else {
-				log<LOG_DEBUG>(" -> Job %1% is not released") % seg.getID();
-				log<LOG_DEBUG>(" -> No need to check further");
+			}
+			if (!(f & jc::POSSIBLY_RELEASED) || !(f & jc::POSSIBLY_FREE)) {
 				continue;
 			}
+			if (candidates != nullptr) {
+				candidates->emplace_back(bk.id[i]);
+			}
+			if constexpr (fixedPriorityFastPath) {
+				ordered.emplace_back(bk.id[i], !(f & jc::CERTAINLY_RELEASED) ? readiness::possible
+											   : (f & jc::CERTAINLY_FREE) ? readiness::certain : readiness::released);
+			}
 
-			// make queue of certain ready jobs
-			if (s.getTimeStamp() >= seg.getArrival().until()) {
-				// check if the processor is available
-				if (s.getProcessorAvailability(seg.getAssignedProcessorSet(), 1).max() <= s.getTimeStamp()) {
-					certainReadyJobs.emplace_back(seg.getID());
-				} else if (s.getProcessorAvailability(seg.getAssignedProcessorSet(), 1).min() <= s.getTimeStamp()) {
+			if (f & jc::CERTAINLY_RELEASED) {
+				if (f & jc::CERTAINLY_FREE) {
+					certainReadyJobs.emplace_back(bk.id[i]);
+				} else {
 					// jobs that certainly released but their resource is not certainly available
-					certainReleasedJobs.emplace_back(seg.getID());
+					certainReleasedJobs.emplace_back(bk.id[i]);
 				}
+			} else {
+				// possible ready jobs are jobs that are neither certainly ready nor certainly released
+				possibleReadyJobs.emplace_back(bk.id[i]);
 			}
 		}
 
-		// make queue of possible ready jobs
-		// possible ready jobs are jobs that are not in certainly ready jobs
-		readyQueue tempQueue;
-		tempQueue.reserve(allReadyJobs.size());
-		std::set_difference(allReadyJobs.begin(), allReadyJobs.end(), certainReadyJobs.begin(),
-							certainReadyJobs.end(), std::back_inserter(tempQueue));
-
-		std::set_difference(tempQueue.begin(), tempQueue.end(), certainReleasedJobs.begin(),
-							certainReleasedJobs.end(), std::back_inserter(possibleReadyJobs));
+		// (not with partial-order reduction: a chain goes on from the rest of the selected queue, and the
+		// decisive queues leave out the jobs that cannot be selected first but can be selected next)
+		if constexpr (fixedPriorityFastPath) {
+			if (!partialOrderReduction) {
+				return makeDecisiveQueues(ready, ordered);
+			}
+		}
 
 		// make ready queues (union of possible ready jobs and certainly ready jobs)
 		for (auto q: makePowerset(possibleReadyJobs)) {
@@ -561,6 +1611,48 @@ public:
 	}
 
 
+	// job-level fixed-priority policies select the first job of a ready queue in the order of the policy
+	// (the bucket order): only the jobs up to the first certainly ready job can be selected, so there is one
+	// queue per such job (with the certainly ready jobs) and the empty queue if no job is certainly ready
+	// the certainly released jobs appear together in the queues, so only the first of them can be selected
+	readyQueues makeDecisiveQueues(const readyJobs &ready,
+								   const std::vector<std::pair<jobID, readiness>> &ordered) {
+		readyQueues queues;
+		bool idle = true;
+		bool releasedSeen = false;
+		auto visit = [&](const std::pair<jobID, readiness> &job) {
+			if (job.second == readiness::certain) {
+				queues.emplace_back(ready.certain);
+				idle = false;
+				return false;
+			}
+			if (job.second == readiness::released) {
+				if (!releasedSeen) {
+					readyQueue q(ready.certain);
+					q.insert(q.end(), ready.released.begin(), ready.released.end());
+					queues.emplace_back(std::move(q));
+					releasedSeen = true;
+				}
+				return true;
+			}
+			readyQueue q;
+			q.reserve(ready.certain.size() + 1);
+			q.emplace_back(job.first);
+			q.insert(q.end(), ready.certain.begin(), ready.certain.end());
+			queues.emplace_back(std::move(q));
+			return true;
+		};
+		if (scheduler<Time>::pickFront) {
+			for (auto it = ordered.begin(); it != ordered.end() && visit(*it); ++it);
+		} else {
+			for (auto it = ordered.rbegin(); it != ordered.rend() && visit(*it); ++it);
+		}
+		if (idle) {
+			queues.emplace_back();
+		}
+		return queues;
+	}
+
 	readyQueues makePowerset(readyQueue &queue) {
 		readyQueues powerset;
 		powerset.reserve(1 << queue.size()); // Reserve space for all subsets
@@ -580,127 +1672,38 @@ public:
 		return powerset;
 	}
 
-	std::unordered_map<std::string, Interval<Time>>
-	makeAvailableResourcesMap(const queue<Time> &rq, const state<Time> &currentState) {
-		// make a map of available resources
-		// key: resource name (e.g. "P1")
-		// value: interval of possible available resources (e.g. [1, 10] 1: certainly available, 10: possibly available)
-		std::unordered_map<std::string, Interval<Time>> availableResources;
-		for (int processors_ID = 0; processors_ID < processors.size(); processors_ID++) {
-			auto name = processors[processors_ID].getName();
-			// find number of possibly available resources
-			// Since job is on the queue, one of the resources is certainly available
-			unsigned int certainlyAvailableResources = 0;
-			unsigned int possiblyAvailableResources = 0;
-			for (const auto &seg: rq.getElementsByID()) {
-				auto it = jobsByID.find(seg);
-				if (it != jobsByID.end()) {
-					auto seg_processors_ID = it->second.getAssignedProcessorSet();
-					if (seg_processors_ID == processors_ID && certainlyAvailableResources == 0) {
+	// set the range of the number of available cores of each cluster for the given ready queue at the given time
+	// the lower bound is the number of certainly available cores and the upper bound the number
+	// of possibly available cores; the whole computation is skipped if the policy never reads them
+	void makeAvailableResources(const queue<Time> &rq, const state<Time> &currentState, Time time,
+								resourceCombinations &combinations) {
+		if constexpr (policy::readsAvailableResources<scheduler<Time>>::value) {
+			for (std::size_t processors_ID = 0; processors_ID < processors.size(); processors_ID++) {
+				// Since job is on the queue, one of the resources is certainly available
+				unsigned int certainlyAvailableResources = 0;
+				unsigned int possiblyAvailableResources = 0;
+				for (const auto &seg: rq.elements) {
+					if (jobsByID.find(seg)->second.getAssignedProcessorSet() == processors_ID) {
 						certainlyAvailableResources++;
 						possiblyAvailableResources++;
 						break;
 					}
-				} else {
-					log<LOG_ERROR>("Job %1% not found") % seg;
-					assert(false);
-				}
-
-
-			}
-
-
-			for (int i = certainlyAvailableResources + 1; i <= processors[processors_ID].getNumCores(); i++) {
-				auto availability = currentState.getProcessorAvailability(processors_ID, i);
-				if (availability.max() <= currentState.getTimeStamp()) {
-					certainlyAvailableResources++;
-					possiblyAvailableResources++;
-				} else if (availability.min() <= currentState.getTimeStamp() &&
-						   currentState.getTimeStamp() < availability.max()) {
-					possiblyAvailableResources++;
 				}
-			}
-
-			availableResources[name] = Interval<Time>(certainlyAvailableResources, possiblyAvailableResources);
-		}
-		return availableResources;
-	}
-
-	std::vector<std::unordered_map<std::string, unsigned int>> makeAllCombinationsOfAvailableResources(
-			std::unordered_map<std::string, Interval<Time>> &availableResources) {
-		// make a vector of all possible combinations of number of available resources
-		std::vector<std::unordered_map<std::string, unsigned int>> combinationsMap;
-		// make a vector of possible number of available resources range
-		// e.g. [2, 10] 2: certainly available, 10: possibly available
-		// 10 - 1 = 9 possible number of available resources
-		std::vector<unsigned int> availablity;
-		for (auto &resource: availableResources) {
-			availablity.push_back(resource.second.max() - resource.second.min());
-		}
-
-		std::vector<unsigned int> combination;
-		std::vector<std::vector<unsigned int>> combinations;
-		combinations = makeAllCombinations(availablity, combination, combinations, 0);
 
-		// make a map of all possible combinations of number of available resources
-		// key: resource name (e.g. "P1")
-		// value: number of available resources (e.g. 3)
-		for (auto &c: combinations) {
-			std::unordered_map<std::string, unsigned int> combinationMap;
-			int i = 0;
-			for (auto &resource: availableResources) {
-				combinationMap[resource.first] = resource.second.min() + c[i];
-				i++;
-			}
-			combinationsMap.push_back(combinationMap);
-		}
-
-
-		// print all possible combinations of number of available resources
-		std::string temp;
-		temp.append("combinationMap: {");
-		for (auto &c: combinationsMap) {
-			temp.append(" {");
-			for (auto &i: c) {
-				temp.append(i.first);
-				temp.append(": ");
-				temp.append(std::to_string(i.second));
-				temp.append(", ");
-			}
-			temp.append("}");
-		}
-		log<LOG_DEBUG>("%1%}") % temp;
-
-		return combinationsMap;
-	}
-
-	std::vector<std::vector<unsigned int>>
-	makeAllCombinations(std::vector<unsigned int> availablity, std::vector<unsigned int> &combination,
-						std::vector<std::vector<unsigned int>> &combinations,
-						unsigned int index) {
-		if (availablity.size() == 0) {
-			log<LOG_DEBUG>("No available resources");
-			return combinations;
-		}
-
-		for (int i = 0; i <= availablity[index]; ++i) {
-			if (index == 0) {
-				combination.clear();
-				for (int j = 0; j < availablity.size(); ++j) {
-					combination.push_back(0);
+				for (unsigned int i = certainlyAvailableResources + 1; i <= processors[processors_ID].getNumCores(); i++) {
+					auto availability = currentState.getProcessorAvailability(processors_ID, i);
+					if (availability.max() <= time) {
+						certainlyAvailableResources++;
+						possiblyAvailableResources++;
+					} else if (availability.min() <= time && time < availability.max()) {
+						possiblyAvailableResources++;
+					}
 				}
-			}
 
-			combination[index] = i;
-			if (index == availablity.size() - 1) {
-				combinations.push_back(combination);
-			} else {
-				makeAllCombinations(availablity, combination, combinations, index + 1);
+				combinations.setRange(processors_ID, certainlyAvailableResources, possiblyAvailableResources);
 			}
-
 		}
-
-		return combinations;
+		combinations.begin();
 	}
 
 
@@ -729,7 +1732,8 @@ public:
 #endif
 	}
 
-	std::stringstream getFormattedOutput() {
+	// withStats: add the statistics of the exploration (caches, reductions, decomposition)
+	std::stringstream getFormattedOutput(bool withStats = false) {
 		std::stringstream ss;
 		TextTable t('-', '|', '+');
 		t.add(" Output file ");
@@ -739,6 +1743,7 @@ public:
 		t.add(" memory (MB) ");
 		t.add(" Timeout? ");
 		t.add(" #CPUs ");
+		t.add(" Method ");
 		t.endOfRow();
 		t.add(jobFile);
 		t.add(completed ? "Yes" : "No");
@@ -747,15 +1752,121 @@ public:
 		t.add(std::to_string(getRAM()));
 		t.add(timedOut ? "Yes" : "No");
 		t.add(std::to_string(resourceSet.size()));
+		t.add(method);
 		t.endOfRow();
 
 		t.setAlignment(3, TextTable::Alignment::RIGHT);
 		ss << t;
 
+		if (screened || !withStats) {
+			return ss;
+		}
+
+		TextTable st('-', '|', '+');
+		st.add(" Scheduler calls ");
+		st.add(" Cache hits ");
+		st.add(" Cache hit rate ");
+		st.add(" Batched decisions ");
+		st.add(" Peeks ");
+		st.add(" Peek hit rate ");
+		st.add(" Pruned events ");
+		if (horizon.numHyperperiods > 1) {
+			st.add(" Hyperperiods ");
+			st.add(" Steady state ");
+		}
+		if (symmetryReduction) {
+			st.add(" Symmetric merges ");
+			st.add(" Reduction factor ");
+		}
+		if (partialOrderReduction) {
+			st.add(" Chained dispatches ");
+		}
+		if (numSubsystems > 1) {
+			st.add(" Clusters ");
+		}
+		if (numSubmodels > 1) {
+			st.add(" Sub-models ");
+			st.add(" Split intervals ");
+		}
+		if (windowStarts.size() > 1) {
+			st.add(" Time windows ");
+			st.add(" Window starts ");
+		}
+		if (refinement) {
+			st.add(" Refinements ");
+			st.add(" Exact merging ");
+		}
+		if (numSimulations > 0) {
+			st.add(" Simulations ");
+			st.add(" Tight bounds ");
+		}
+		if (!frontierFile.empty()) {
+			st.add(" Resumed at ");
+			st.add(" Reused states ");
+		}
+		st.endOfRow();
+		st.add(std::to_string(decisions->getHits() + decisions->getMisses()));
+		st.add(std::to_string(decisions->getHits()));
+		st.add(std::to_string(decisions->getHitRate()));
+		st.add(std::to_string(exploreBatch.getNumDecisions() + peekBatch.getNumDecisions()));
+		st.add(std::to_string(peeks.getHits() + peeks.getMisses()));
+		st.add(std::to_string(peeks.getHitRate()));
+		st.add(std::to_string(numPrunedEvents));
+		if (horizon.numHyperperiods > 1) {
+			st.add(std::to_string(lastBoundary + 1) + "/" + std::to_string(horizon.numHyperperiods));
+			st.add(steadyState ? "Yes" : "No");
+		}
+		if (symmetryReduction) {
+			st.add(std::to_string(numSymmetricMerges));
+			// estimate: without the reduction, each symmetric merge would have made a new state
+			st.add(std::to_string((double) (numStates + numSymmetricMerges) / (double) numStates));
+		}
+		if (partialOrderReduction) {
+			st.add(std::to_string(numChainedDispatches));
+		}
+		if (numSubsystems > 1) {
+			st.add(std::to_string(numSubsystems));
+		}
+		if (numSubmodels > 1) {
+			st.add(std::to_string(numSubmodels));
+			st.add(splitIntervals);
+		}
+		if (windowStarts.size() > 1) {
+			std::string starts;
+			for (auto t: windowStarts) {
+				starts += (starts.empty() ? "" : ", ") + std::to_string(t * timeScale);
+			}
+			st.add(std::to_string(windowStarts.size()));
+			st.add(starts);
+		}
+		if (refinement) {
+			st.add(std::to_string(numRefinements));
+			if (exactMerging) {
+				std::size_t numClusters = std::count(exactMerging->clusters.begin(), exactMerging->clusters.end(), true);
+				st.add("[" + std::to_string(exactMerging->times.min() * timeScale) + ", "
+					   + std::to_string(exactMerging->times.max() * timeScale) + "] on "
+					   + std::to_string(numClusters) + "/" + std::to_string(exactMerging->clusters.size())
+					   + " clusters");
+			} else {
+				st.add("-");
+			}
+		}
+		if (numSimulations > 0) {
+			st.add(std::to_string(numSimulations));
+			st.add(std::to_string(numTightBounds) + "/" + std::to_string(responseTimes.size()));
+		}
+		if (!frontierFile.empty()) {
+			st.add(resumedAt ? std::to_string(*resumedAt * timeScale) : "-");
+			st.add(std::to_string(numReusedStates));
+		}
+		st.endOfRow();
+		ss << st;
+
 		return ss;
 	}
 
-	std::stringstream getRawOutput() {
+	// withMethod: add the method that decided the task set (only if another method than the exploration can)
+	std::stringstream getRawOutput(bool withMethod = false) {
 		std::stringstream ss;
 		ss << jobFile;
 		ss << ",  " << (completed ? "Yes" : "No");
@@ -763,10 +1874,52 @@ public:
 		ss << ",  " << double(timer);
 		ss << ",  " << getRAM();
 		ss << ",  " << (timedOut ? "Yes" : "No");
-		ss << ",  " << resourceSet.size() << std::endl;
+		ss << ",  " << resourceSet.size();
+		if (withMethod)
+			ss << ",  " << method;
+		ss << std::endl;
 		return ss;
 	}
 
+	bool isSchedulable() const {
+		return completed;
+	}
+
+	// the exploration found a deadline miss (it was not stopped by a timeout or from outside)
+	bool foundDeadlineMiss() const {
+		return aborted && !timedOut;
+	}
+
+	bool isTimedOut() const {
+		return timedOut;
+	}
+
+	unsigned long getNumStates() const {
+		return numStates;
+	}
+
+	// compare the completion times with the ones observed in concrete schedules
+	void setObservedCompletions(const std::unordered_map<jobID, Interval<Time>> &observed, unsigned long runs) {
+		numSimulations = runs;
+		numTightBounds = 0;
+		for (const auto &o: observed) {
+			auto rt = responseTimes.find(o.first);
+			if (rt == responseTimes.end()) {
+				continue;
+			}
+			if (o.second.max() > rt->second.max() || o.second.min() < rt->second.min()) {
+				log<LOG_WARNING>("Job %1% completed at %2% in a concrete schedule, outside of its analyzed bounds")
+				% o.first % o.second;
+			} else if (o.second.max() == rt->second.max()) {
+				numTightBounds++;
+			}
+		}
+	}
+
+	void setTimeScale(Time scale) {
+		timeScale = scale;
+	}
+
 	void makeCSVFile() {
 		std::ofstream csvFile;
 		std::string fileName = jobFile.substr(0, jobFile.find_last_of("."));
@@ -774,24 +1927,293 @@ public:
 		// add header
 		rtCsv << "Task ID" << "Job ID" << "BCCT" << "WCCT" << "BCRT" << "WCRT" << endrow;
 
+		// in a steady state, the jobs of the first hyperperiod stand for their copies in all analyzed hyperperiods
+		if (steadyState) {
+			foldHyperperiods();
+		}
+		// interchangeable jobs are reported with the response times of their whole class
+		if (symmetryReduction) {
+			foldSymmetryClasses();
+		}
+
 		// add response and completion times
-		for (auto &seg: jobs) {
+		const std::size_t numReported = steadyState ? horizon.jobsPerHyperperiod : jobs.size();
+		for (std::size_t i = 0; i < numReported; i++) {
+			const auto &seg = jobs[i];
 			auto rt = responseTimes.find(seg.getID());
 			if (rt == responseTimes.end()) {
 				rtCsv << seg.getID().task << seg.getID().job << -1 << -1 << -1 << -1 << endrow;
 			} else {
-				rtCsv << seg.getID().task << seg.getID().job << rt->second.min() << rt->second.max()
-					  << rt->second.min() - seg.getArrival().min() << rt->second.max() - seg.getArrival().max()
+				rtCsv << seg.getID().task << seg.getID().job << rt->second.min() * timeScale
+					  << rt->second.max() * timeScale
+					  << (rt->second.min() - seg.getArrival().min()) * timeScale
+					  << (rt->second.max() - seg.getArrival().max()) * timeScale
 					  << endrow;
 			}
 		}
 	}
 
+	// rebuild the paths to the deadline miss and to the latest completions of the requested jobs
+	void extractWitnesses() {
+		if (missSource) {
+			witnesses.push_back({"misses its deadline", *missSource, predecessors.path(missSource->from)});
+		}
+		bool all = std::find(witnessJobs.begin(), witnessJobs.end(), "all") != witnessJobs.end();
+		for (const auto &j: jobs) {
+			auto source = completionSources.find(j.getID());
+			if (source == completionSources.end()
+				|| (!all && std::find(witnessJobs.begin(), witnessJobs.end(), j.getID().string()) == witnessJobs.end())) {
+				continue;
+			}
+			witnesses.push_back({"completes", source->second, predecessors.path(source->second.from)});
+		}
+	}
+
+	// one path of transitions per witness: the states from the initial state, the time stamp of each state and
+	// the jobs dispatched to reach it (empty for a time transition), then the outcome
+	void makeWitnessFile() {
+		if (witnessJobs.empty()) {
+			return;
+		}
+		std::string fileName = jobFile.substr(0, jobFile.find_last_of("."));
+		csvfile witnessCsv(fileName.append("_witness.csv"), false, ",");
+		witnessCsv << "Task ID" << "Job ID" << "Outcome" << "Step" << "State" << "Time" << "Dispatched" << endrow;
+		for (const auto &w: witnesses) {
+			const jobID &id = w.source.job;
+			std::size_t step = 0;
+			for (const auto &st: w.steps) {
+				witnessCsv << id.task << id.job << w.outcome << step++ << st.state << st.timeStamp * timeScale
+						   << st.dispatched << endrow;
+			}
+			witnessCsv << id.task << id.job << w.outcome << step << -1 << w.source.time * timeScale
+					   << w.source.dispatched << endrow;
+		}
+	}
+
+	// add the results of the analysis of a subsystem
+	void absorb(const transitionSystem &part) {
+		numStates += part.numStates;
+		completed = completed && part.completed;
+		aborted = aborted || part.aborted;
+		timedOut = timedOut || part.timedOut;
+		// (the jobs of the sub-models of a split are the same, their completion times are joined)
+		for (const auto &rt: part.responseTimes) {
+			auto known = responseTimes.find(rt.first);
+			if (known == responseTimes.end()) {
+				responseTimes.emplace(rt.first, rt.second);
+			} else {
+				known->second.widen(rt.second);
+			}
+		}
+		numPrunedEvents += part.numPrunedEvents;
+		numSymmetricMerges += part.numSymmetricMerges;
+		numChainedDispatches += part.numChainedDispatches;
+		exploreBatch.absorbCounts(part.exploreBatch);
+		peekBatch.absorbCounts(part.peekBatch);
+		peeks.absorbCounts(part.peeks);
+		lastBoundary = std::max(lastBoundary, part.lastBoundary);
+		// one witness per job and outcome, the one with the latest outcome
+		for (const auto &w: part.witnesses) {
+			auto same = std::find_if(witnesses.begin(), witnesses.end(), [&](const witness &other) {
+				return other.source.job == w.source.job && other.outcome == w.outcome;
+			});
+			if (same == witnesses.end()) {
+				witnesses.push_back(w);
+			} else if (same->source.time < w.source.time) {
+				*same = w;
+			}
+		}
+		if (witnessJobs.empty()) {
+			witnessJobs = part.witnessJobs;
+		}
+		numReusedStates += part.numReusedStates;
+		if (part.resumedAt && (!resumedAt || *part.resumedAt < *resumedAt)) {
+			resumedAt = part.resumedAt;
+		}
+		refinement = refinement || part.refinement;
+		numRefinements += part.numRefinements;
+		if (part.exactMerging && !exactMerging) {
+			exactMerging = part.exactMerging;
+		} else if (part.exactMerging) {
+			exactMerging->times.widen(part.exactMerging->times);
+			for (std::size_t c = 0; c < exactMerging->clusters.size(); c++) {
+				exactMerging->clusters[c] = exactMerging->clusters[c] || part.exactMerging->clusters[c];
+			}
+		}
+		if (part.windowStarts.size() > windowStarts.size()) {
+			windowStarts = part.windowStarts;
+		}
+		numSubsystems++;
+	}
+
+	// passes of a counterexample-guided refinement of the merging (explore(region, timeout): one exploration
+	// with exact merging in the region); the region grows before each miss: from the release of the job that
+	// missed its deadline on its cluster, then over a time range twice as long until it starts at 0, then on all
+	// clusters; a miss found with exact merging everywhere before it is confirmed
+	// (the last pass is returned, it counts the states of all passes)
+	template<class Explore>
+	static std::unique_ptr<transitionSystem> refineMerging(Explore explore, double timeout) {
+		cpuTime elapsed;
+		elapsed.start();
+		std::unique_ptr<transitionSystem> pass = explore(std::nullopt, timeout);
+		std::optional<mergeRegion> region;
+		unsigned long numEarlierStates = 0;
+		cpuTime earlierTime;
+		unsigned int numPasses = 0;
+		while (pass->foundDeadlineMiss() && pass->missSource) {
+			const job<Time> &missed = pass->jobsByID.find(pass->missSource->job)->second;
+			const Time missTime = pass->missSource->time;
+			const std::size_t numClusters = pass->resourceSet.size();
+			if (!region) {
+				region = mergeRegion{Interval<Time>(missed.getArrival().min(), missTime),
+									 std::vector<bool>(numClusters, false)};
+			} else if (region->times.min() > 0) {
+				Time from = std::min(missed.getArrival().min(), region->times.min() - region->times.length());
+				if (from >= region->times.min() || from < 0) {
+					from = 0;
+				}
+				region->times = Interval<Time>(from, std::max(region->times.max(), missTime));
+			} else if (!std::all_of(region->clusters.begin(), region->clusters.end(), [](bool c) { return c; })) {
+				region->times.extendTo(missTime);
+				region->clusters.assign(numClusters, true);
+			} else if (missTime <= region->times.max()) {
+				log<LOG_INFO>("Deadline miss of job %1% confirmed with exact merging") % missed.getID();
+				break;
+			} else {
+				region->times.extendTo(missTime);
+			}
+			region->clusters[missed.getAssignedProcessorSet()] = true;
+			log<LOG_INFO>("Deadline miss of job %1% at %2%, merging exactly in [%3%, %4%]") % missed.getID()
+			% missTime % region->times.min() % region->times.max();
+
+			// the passes share the time limit
+			double remaining = timeout > 0 ? std::max(timeout - double(elapsed), 0.0) : timeout;
+			auto next = explore(region, remaining);
+			numEarlierStates += pass->numStates;
+			earlierTime.add(pass->timer);
+			numPasses++;
+			if (next->timedOut) {
+				// the miss of the last pass stands, unconfirmed
+				log<LOG_WARNING>("Refinement of the merging timed out");
+				numEarlierStates += next->numStates;
+				earlierTime.add(next->timer);
+				break;
+			}
+			pass = std::move(next);
+		}
+		pass->numStates += numEarlierStates;
+		pass->timer.add(earlierTime);
+		pass->numRefinements = numPasses;
+		pass->refinement = true;
+		return pass;
+	}
+
+	// analyze models made from the jobs (models(i): the jobs of the i-th model) on all hardware threads,
+	// and absorb their results
+	template<class Models, class Analysis>
+	void analyzeInParallel(std::size_t numModels, Models models, Analysis analysis) {
+		std::size_t numClusters = 0;
+		std::atomic<std::size_t> next(0);
+		std::mutex lock;
+		std::vector<std::thread> threads;
+		const std::size_t numThreads = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()),
+															 numModels);
+		for (std::size_t t = 0; t < numThreads; t++) {
+			threads.emplace_back([&]() {
+				for (std::size_t i = next++; i < numModels; i = next++) {
+					jobSet model = models(i);
+					auto part = analysis(model);
+					// the jobs of the models are not copies of each other across the hyperperiods
+					if (part.steadyState) {
+						part.unfoldHyperperiods();
+					}
+					std::lock_guard<std::mutex> guard(lock);
+					absorb(part);
+					timer.add(part.timer);
+					numClusters = std::max(numClusters, part.numSubsystems);
+				}
+			});
+		}
+		for (auto &t: threads) {
+			t.join();
+		}
+		numSubsystems = numClusters;
+	}
+
+	// report the jobs of all hyperperiods after a steady state: the later copies of each job of the first
+	// hyperperiod get its folded completion times
+	void unfoldHyperperiods() {
+		foldHyperperiods();
+		for (std::size_t i = 0; i < horizon.jobsPerHyperperiod; i++) {
+			auto rt = responseTimes.find(jobs[i].getID());
+			if (rt == responseTimes.end()) {
+				continue;
+			}
+			for (long long h = 1; h < horizon.numHyperperiods; h++) {
+				Interval<Time> shifted(rt->second.min() + horizon.hyperperiod * h,
+									   rt->second.max() + horizon.hyperperiod * h);
+				responseTimes.insert_or_assign(jobs[i + h * horizon.jobsPerHyperperiod].getID(), shifted);
+			}
+		}
+		steadyState = false;
+	}
+
+	// merge the completion times of the later copies of each job of the first hyperperiod into it
+	void foldHyperperiods() {
+		for (std::size_t i = 0; i < horizon.jobsPerHyperperiod; i++) {
+			for (long long h = 1; h <= lastBoundary; h++) {
+				const auto &copy = jobs[i + h * horizon.jobsPerHyperperiod];
+				auto rt = responseTimes.find(copy.getID());
+				if (rt == responseTimes.end()) {
+					continue;
+				}
+				Interval<Time> shifted(rt->second.min() - horizon.hyperperiod * h,
+									   rt->second.max() - horizon.hyperperiod * h);
+				auto first = responseTimes.find(jobs[i].getID());
+				if (first == responseTimes.end()) {
+					responseTimes.emplace(jobs[i].getID(), shifted);
+				} else {
+					first->second.widen(shifted);
+				}
+			}
+		}
+	}
+
+	void foldSymmetryClasses() {
+		for (const auto &cls: symmetryClasses) {
+			std::optional<Interval<Time>> merged;
+			for (auto i: cls) {
+				auto rt = responseTimes.find(jobs[i].getID());
+				if (rt != responseTimes.end()) {
+					if (merged)
+						merged->widen(rt->second);
+					else
+						merged = rt->second;
+				}
+			}
+			if (merged) {
+				for (auto i: cls) {
+					responseTimes.insert_or_assign(jobs[i].getID(), *merged);
+				}
+			}
+		}
+	}
+
 	void makeDotFile() {
 		std::string fileName = jobFile.substr(0, jobFile.find_last_of("."));
 		transitionStructure.generateDotFile(fileName.append(".dot"));
 	}
 
+	// a job is stored in every bucket that its scheduling window overlaps: with one bucket per job,
+	// long windows span many buckets, so the buckets are at least a quarter of the mean window long
+	Time bucketWidth(const jobSet &jobs) {
+		Time windows = 0;
+		for (auto &j: jobs) {
+			windows += j.schedulingWindow().length();
+		}
+		return std::max(maxDeadline(jobs) / jobs.size(), windows / jobs.size() / 4);
+	}
+
 	Time maxDeadline(const jobSet &jobs) {
 		Time dl = 0;
 		for (auto &j: jobs) {
@@ -0,0 +1,154 @@
+#ifndef UNCERTAINTY_SPLIT_HPP
+#define UNCERTAINTY_SPLIT_HPP
+
+#include <vector>
+#include <string>
+#include <type_traits>
+#include "job.hpp"
+#include "interval.hpp"
+
+// sub-models of a workload in which the arrival or execution-time intervals of some jobs are partitioned into
+// sub-intervals, one sub-model per combination of sub-intervals
+// every concrete schedule is a schedule of one of the sub-models, so the union of their completion times bounds
+// the completion times of the jobs; the intervals are split per job, since the jobs of a task vary independently
+// the split intervals are the ones that likely cause the most branching: wide intervals of jobs whose
+// uncertainty overlaps the scheduling windows of many other jobs of their cluster
+// a sub-model only restricts the original model if the policy does not read the split intervals: the intervals
+// a policy reads (a sort key like cost_max or laxity, the WCET of a job or a task) are not split, since a
+// sub-model would then order the jobs differently
+template<class Time>
+class uncertaintySplit {
+public:
+	enum class parameter {
+		arrival, cost
+	};
+
+	struct split {
+		std::size_t job;
+		parameter kind;
+		unsigned int pieces;
+	};
+
+	// at most the given number of sub-models (a power of two): each step halves the pieces of the interval
+	// with the highest score; splitArrival, splitCost: the kinds of intervals that may be split
+	uncertaintySplit(const std::vector<job<Time>> &jobs, unsigned int maxSubmodels, bool splitArrival = true,
+					 bool splitCost = true) : jobs(jobs) {
+		std::vector<split> candidates;
+		std::vector<double> weights;
+		for (std::size_t i = 0; i < jobs.size(); i++) {
+			for (auto kind: {parameter::arrival, parameter::cost}) {
+				Interval<Time> range = rangeOf(jobs[i], kind);
+				if (range.min() == range.max() || !(kind == parameter::arrival ? splitArrival : splitCost)) {
+					continue;
+				}
+				// the window in which the uncertainty of the job can change a decision
+				Interval<Time> window = kind == parameter::arrival ? jobs[i].getArrival()
+																	: jobs[i].getArrival() + jobs[i].getCost();
+				std::size_t overlaps = 0;
+				for (std::size_t j = 0; j < jobs.size(); j++) {
+					if (j != i && jobs[j].getAssignedProcessorSet() == jobs[i].getAssignedProcessorSet()
+						&& jobs[j].getArrival().min() <= window.max() && window.min() < jobs[j].getDeadline()) {
+						overlaps++;
+					}
+				}
+				candidates.push_back({i, kind, 1});
+				weights.push_back((double) (range.max() - range.min()) * (double) (1 + overlaps));
+			}
+		}
+
+		for (unsigned int n = 2; n <= maxSubmodels && !candidates.empty(); n *= 2) {
+			std::size_t best = candidates.size();
+			for (std::size_t c = 0; c < candidates.size(); c++) {
+				if (canSplit(candidates[c], candidates[c].pieces * 2)
+					&& (best == candidates.size()
+						|| weights[c] / candidates[c].pieces > weights[best] / candidates[best].pieces)) {
+					best = c;
+				}
+			}
+			if (best == candidates.size()) {
+				break;
+			}
+			candidates[best].pieces *= 2;
+			numSubmodels *= 2;
+		}
+		for (const auto &c: candidates) {
+			if (c.pieces > 1) {
+				splits.push_back(c);
+			}
+		}
+	}
+
+	std::size_t getNumSubmodels() const {
+		return numSubmodels;
+	}
+
+	const std::vector<split> &getSplits() const {
+		return splits;
+	}
+
+	// the split intervals, like T0S1 arrival/2
+	std::string describe() const {
+		std::string d;
+		for (const auto &s: splits) {
+			d += (d.empty() ? "" : ", ") + jobs[s.job].getID().string()
+				 + (s.kind == parameter::arrival ? " arrival/" : " cost/") + std::to_string(s.pieces);
+		}
+		return d;
+	}
+
+	// the jobs of the sub-model with the given index (the index is read digit by digit, one digit per split)
+	std::vector<job<Time>> submodel(std::size_t index) const {
+		std::vector<Interval<Time>> arrivals, costs;
+		arrivals.reserve(jobs.size());
+		costs.reserve(jobs.size());
+		for (const auto &j: jobs) {
+			arrivals.push_back(j.getArrival());
+			costs.push_back(j.getCost());
+		}
+		for (const auto &s: splits) {
+			const unsigned int piece = (unsigned int) (index % s.pieces);
+			index /= s.pieces;
+			(s.kind == parameter::arrival ? arrivals : costs)[s.job] = pieceOf(rangeOf(jobs[s.job], s.kind), piece,
+																				s.pieces);
+		}
+		std::vector<job<Time>> result;
+		result.reserve(jobs.size());
+		for (std::size_t i = 0; i < jobs.size(); i++) {
+			const job<Time> &j = jobs[i];
+			result.emplace_back(j.getName(), j.getID(), arrivals[i], costs[i], j.getDeadline(),
+								j.getAssignedProcessorSet(), j.getPriority(), j.getTaskPeriod());
+		}
+		return result;
+	}
+
+private:
+	const std::vector<job<Time>> &jobs;
+	std::vector<split> splits;
+	std::size_t numSubmodels = 1;
+
+	static Interval<Time> rangeOf(const job<Time> &j, parameter kind) {
+		return kind == parameter::arrival ? j.getArrival() : j.getCost();
+	}
+
+	// a discrete interval has one value per time unit
+	bool canSplit(const split &s, unsigned int pieces) const {
+		if constexpr (std::is_integral<Time>::value) {
+			Interval<Time> range = rangeOf(jobs[s.job], s.kind);
+			return (Time) pieces <= range.max() - range.min() + 1;
+		}
+		return true;
+	}
+
+	// the k-th of p pieces of a range
+	static Interval<Time> pieceOf(const Interval<Time> &range, unsigned int k, unsigned int p) {
+		if constexpr (std::is_integral<Time>::value) {
+			const Time values = range.max() - range.min() + 1;
+			return Interval<Time>(range.min() + values * k / p, range.min() + values * (k + 1) / p - 1);
+		} else {
+			const Time width = range.max() - range.min();
+			return Interval<Time>(range.min() + width * k / p, range.min() + width * (k + 1) / p);
+		}
+	}
+};
+
+#endif
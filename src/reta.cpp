@@ -1,12 +1,18 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <sstream>
 #include "time.hpp"
 #include "OptionParser.h"
 #include "formattedLog.hpp"
 #include "tools.hpp"
 #include "dag.hpp"
 #include "transitionSystem.hpp"
+#include "screening.hpp"
+#include "simulator.hpp"
+#include "sensitivity.hpp"
+#include "uncertaintySplit.hpp"
+#include "timeWindows.hpp"
 #include "models/systemModel.hpp"
 
 
@@ -25,6 +31,22 @@ static bool wantNaive;
 static bool wantDense = false;
 static double timeout = 14400;
 static bool rawFormat = false;
+static bool wantStats = false;
+static bool wantTimeScaling = true;
+static unsigned int numHyperperiods = 1;
+static bool wantSymmetry = false;
+static bool wantPartialOrder = false;
+static bool wantDecomposition = true;
+static bool wantScreening = false;
+static bool wantFalsification = false;
+static unsigned long numSimulations = 0;
+static std::vector<std::string> witnessJobs;
+static std::string frontierFile;
+static std::string sensitivityTask;
+static bool wantBreakdown = false;
+static unsigned int numSubmodels = 1;
+static unsigned int numWindows = 1;
+static bool wantRefinement = false;
 
 // global variables
 
@@ -41,19 +63,73 @@ transitionSystem<Time> makeAnalysis(tools::inputs<Time> &inputs) {
 
 }
 
-// make analysis
+// make analysis of one model
 template<class Time>
 transitionSystem<Time>
-makeAnalysis(std::vector<job<Time>> &inputs, events<Time> systemEvents, std::vector<processor> processors) {
+makeExploration(std::vector<job<Time>> &inputs, events<Time> systemEvents, std::vector<processor> processors,
+                tools::horizon<Time> horizon = {}) {
     // make transition system
     if (wantNaive) {
-        return transitionSystem<Time>::constructNaively(outputFile, inputs, systemEvents, processors, timeout);
+        return transitionSystem<Time>::constructNaively(outputFile, inputs, systemEvents, processors, timeout,
+                                                        horizon, wantSymmetry, wantPartialOrder, wantFalsification,
+                                                        witnessJobs, frontierFile);
+    } else if (wantDecomposition) {
+        return transitionSystem<Time>::constructByCluster(outputFile, inputs, systemEvents, processors, timeout,
+                                                          horizon, wantSymmetry, wantPartialOrder,
+                                                          wantFalsification, witnessJobs, frontierFile,
+                                                          wantRefinement);
+    } else if (wantRefinement) {
+        return transitionSystem<Time>::constructRefined(outputFile, inputs, systemEvents, processors, timeout,
+                                                        horizon, wantSymmetry, wantPartialOrder, wantFalsification,
+                                                        witnessJobs);
     } else {
-        return transitionSystem<Time>::construct(outputFile, inputs, systemEvents, processors, timeout);
+        return transitionSystem<Time>::construct(outputFile, inputs, systemEvents, processors, timeout, horizon,
+                                                 wantSymmetry, wantPartialOrder, wantFalsification, witnessJobs,
+                                                 frontierFile);
     }
 
 }
 
+// make analysis of one model, cut into time windows
+template<class Time>
+transitionSystem<Time>
+makeWindowedAnalysis(std::vector<job<Time>> &inputs, events<Time> systemEvents, std::vector<processor> processors,
+                     tools::horizon<Time> horizon = {}) {
+    if (numWindows > 1) {
+        timeWindows<Time> windows(inputs, systemEvents, numWindows);
+        if (windows.getNumWindows() > 1) {
+            return transitionSystem<Time>::constructByWindow(
+                    outputFile, inputs, systemEvents, processors, timeout, horizon, windows,
+                    [&](std::vector<job<Time>> &jobs) {
+                        return makeExploration<Time>(jobs, systemEvents, processors, horizon);
+                    });
+        }
+        log<LOG_WARNING>("No instant between the jobs can start a time window");
+    }
+    return makeExploration<Time>(inputs, systemEvents, processors, horizon);
+}
+
+// make analysis
+template<class Time>
+transitionSystem<Time>
+makeAnalysis(std::vector<job<Time>> &inputs, events<Time> systemEvents, std::vector<processor> processors,
+             tools::horizon<Time> horizon = {}) {
+    // split the most uncertain intervals that the policy does not read, each sub-model is analyzed as configured
+    if (numSubmodels > 1) {
+        uncertaintySplit<Time> split(inputs, numSubmodels, !policy::readsArrival<scheduler<Time>>::value,
+                                     !policy::readsCost<scheduler<Time>>::value);
+        if (split.getNumSubmodels() > 1) {
+            return transitionSystem<Time>::constructBySplitting(
+                    outputFile, inputs, systemEvents, processors, timeout, horizon, split,
+                    [&](std::vector<job<Time>> &jobs) {
+                        return makeWindowedAnalysis<Time>(jobs, systemEvents, processors, horizon);
+                    });
+        }
+        log<LOG_WARNING>("No arrival or execution-time interval can be split");
+    }
+    return makeWindowedAnalysis<Time>(inputs, systemEvents, processors, horizon);
+}
+
 int main(int argc, char **argv) {
     auto parser = optparse::OptionParser();
 
@@ -75,6 +151,82 @@ int main(int argc, char **argv) {
             .action("store_const").set_const("1")
             .help("print output without formatting (default: false)");
 
+    parser.add_option("--stats").dest("stats").set_default("0")
+            .action("store_const").set_const("1")
+            .help("print the statistics of the exploration (default: false)");
+
+    parser.add_option("--no-time-scaling").dest("noTimeScaling").set_default("0")
+            .action("store_const").set_const("1")
+            .help("do not divide the time parameters by their common divisor (default: false)");
+
+    parser.add_option("--steady-state").dest("steadyState").type("int")
+            .help("analyze up to N hyperperiods and stop once the exploration repeats (default: 1)")
+            .set_default("1");
+
+    parser.add_option("--symmetry").dest("symmetry").set_default("0")
+            .action("store_const").set_const("1")
+            .help("merge states that differ only by swapping jobs with identical parameters that a "
+                  "sort-then-pick policy orders next to each other (default: false)");
+
+    parser.add_option("--partial-order").dest("partialOrder").set_default("0")
+            .action("store_const").set_const("1")
+            .help("dispatch the jobs that the policy is forced to select without intermediate states (default: false)");
+
+    parser.add_option("--no-decomposition").dest("noDecomposition").set_default("0")
+            .action("store_const").set_const("1")
+            .help("analyze all clusters together even if the policy treats them independently (default: false)");
+
+    parser.add_option("--screening").dest("screening").set_default("0")
+            .action("store_const").set_const("1")
+            .help("decide obviously (un)schedulable task sets with analytical tests before exploring, "
+                  "the response times are then not reported (default: false)");
+
+    parser.add_option("--falsify").dest("falsify").set_default("0")
+            .action("store_const").set_const("1")
+            .help("explore the states with the least slack first and stop at the first deadline miss, "
+                  "the response times are then not reported (default: false)");
+
+    parser.add_option("--simulate").dest("simulate").type("int")
+            .help("replay N concrete schedules before the analysis, a deadline miss is reported as a counterexample "
+                  "instead of exploring (default: 0)")
+            .set_default("0");
+
+    parser.add_option("--witness").dest("witness")
+            .help("write a path of transitions to a deadline miss and to the latest completion of the given jobs "
+                  "(comma-separated labels like T0S1, all, or miss for the deadline miss only)")
+            .set_default("");
+
+    parser.add_option("--incremental").dest("incremental").metavar("FILE")
+            .help("store the explored frontiers in FILE and resume from them after an edit of the model, "
+                  "up to the earliest time at which a changed job can influence a decision "
+                  "(not across schedulers or time scales)")
+            .set_default("");
+
+    parser.add_option("--sensitivity").dest("sensitivity").metavar("TASK")
+            .help("search the largest factor by which the execution times of the jobs of TASK can be scaled "
+                  "with the task set staying schedulable")
+            .set_default("");
+
+    parser.add_option("--breakdown").dest("breakdown").set_default("0")
+            .action("store_const").set_const("1")
+            .help("search the largest factor by which all execution times can be scaled with the task set "
+                  "staying schedulable (default: false)");
+
+    parser.add_option("--split").dest("split").type("int").metavar("N")
+            .help("split the widest arrival and execution-time intervals of the jobs that overlap the most others "
+                  "and analyze up to N sub-models (a power of two) in parallel (default: 1)")
+            .set_default("1");
+
+    parser.add_option("--windows").dest("windows").type("int").metavar("N")
+            .help("cut the schedule into up to N time windows at instants that no job spans and analyze them "
+                  "in parallel (default: 1)")
+            .set_default("1");
+
+    parser.add_option("--refine").dest("refine").set_default("0")
+            .action("store_const").set_const("1")
+            .help("after a deadline miss, explore again with exact merging in a growing region before the miss "
+                  "until the miss disappears or is confirmed (default: false)");
+
     parser.add_option("-o", "--output").dest("outputFile")
             .help("name of the output file (default: out.csv)")
             .set_default("out.csv");
@@ -107,9 +259,47 @@ int main(int argc, char **argv) {
     wantNaive = options.get("naive");
 
     rawFormat = options.get("raw");
+    wantStats = options.get("stats");
 
     outputFile = (const std::string) options.get("outputFile");
 
+    wantTimeScaling = !options.get("noTimeScaling");
+
+    numHyperperiods = std::max(1, (int) options.get("steadyState"));
+
+    wantSymmetry = options.get("symmetry");
+
+    wantPartialOrder = options.get("partialOrder");
+
+    wantDecomposition = !options.get("noDecomposition");
+
+    wantScreening = options.get("screening");
+
+    wantFalsification = options.get("falsify");
+
+    numSimulations = std::max(0, (int) options.get("simulate"));
+
+    frontierFile = (const std::string) options.get("incremental");
+
+    sensitivityTask = (const std::string) options.get("sensitivity");
+    // a "task=" prefix is accepted as well
+    if (sensitivityTask.rfind("task=", 0) == 0)
+        sensitivityTask = sensitivityTask.substr(5);
+
+    wantBreakdown = options.get("breakdown");
+
+    numSubmodels = std::max(1, (int) options.get("split"));
+
+    numWindows = std::max(1, (int) options.get("windows"));
+
+    wantRefinement = options.get("refine");
+
+    std::stringstream witnessList((const std::string) options.get("witness"));
+    for (std::string label; std::getline(witnessList, label, ',');) {
+        if (!label.empty())
+            witnessJobs.push_back(label);
+    }
+
 
     // read input files
 //    auto inputs = processFiles<model::time>();
@@ -118,17 +308,145 @@ int main(int argc, char **argv) {
     model::defineTasks();
     model::defineSegments();
 
-    auto inputs = tools::generateSegments<model::time>(model::tasks, model::segments);
+    // analyze in units of the common divisor of all time parameters if the policy allows it
+    // (not for a sensitivity search: the scaled execution times are rounded up to whole time units)
+    model::time timeBase = 1;
+    if (wantTimeScaling && policy::timeScaleInvariant<scheduler<model::time>>::value && !wantBreakdown
+        && sensitivityTask.empty()) {
+        timeBase = tools::timeBase(model::tasks, model::segments, model::systemEvents);
+        if (timeBase > 1)
+            tools::scaleTime(model::tasks, model::segments, model::systemEvents, timeBase);
+    }
+
+    // the explicit segments are not periodic, they are only analyzed within one hyperperiod
+    if (numHyperperiods > 1 && !model::segments.empty()) {
+        log<LOG_WARNING>("Steady-state detection is not supported with explicit segments");
+        numHyperperiods = 1;
+    }
+
+    // the frontier is only compared at the hyperperiod boundaries if the states are explored by time stamp
+    if (numHyperperiods > 1 && wantFalsification) {
+        log<LOG_WARNING>("Steady-state detection is not supported with falsification");
+        numHyperperiods = 1;
+    }
+
+    // the frontiers are only stored at checkpoints if the states are explored by time stamp
+    if (!frontierFile.empty() && wantFalsification) {
+        log<LOG_WARNING>("Incremental re-analysis is not supported with falsification");
+        frontierFile.clear();
+    }
+
+    // only the order of a sort-then-pick policy tells which identical jobs the policy cannot tell apart
+    if (wantSymmetry && !policy::sortThenPick<scheduler<model::time>>::value) {
+        log<LOG_WARNING>("Symmetry reduction is only supported for sort-then-pick policies");
+        wantSymmetry = false;
+    }
+
+    // the naive exploration does not merge states
+    if (wantRefinement && wantNaive) {
+        log<LOG_WARNING>("Refinement of the merging is not supported with the naive exploration");
+        wantRefinement = false;
+    }
+
+    // the passes of a refinement merge differently, each would resume from the frontiers of another one
+    if (!frontierFile.empty() && wantRefinement) {
+        log<LOG_WARNING>("Incremental re-analysis is not supported with refinement of the merging");
+        frontierFile.clear();
+    }
+
+    // the scheduler of a window builds its task table from the jobs of the window only
+    if (numWindows > 1 && policy::readsTaskTable<scheduler<model::time>>::value) {
+        log<LOG_WARNING>("Time windows are not supported for policies that read the task table");
+        numWindows = 1;
+    }
+
+    // the windows would cut the hyperperiods that the steady-state detection compares
+    if (numHyperperiods > 1 && numWindows > 1) {
+        log<LOG_WARNING>("Time windows are not supported with steady-state detection");
+        numWindows = 1;
+    }
+
+    // the windows are different models, each would resume from the frontiers of another one
+    if (!frontierFile.empty() && numWindows > 1) {
+        log<LOG_WARNING>("Incremental re-analysis is not supported with time windows");
+        frontierFile.clear();
+    }
+
+    // the sub-models of a split are different models, each would resume from the frontiers of another one
+    if (!frontierFile.empty() && numSubmodels > 1) {
+        log<LOG_WARNING>("Incremental re-analysis is not supported with split intervals");
+        frontierFile.clear();
+    }
+
+    // the stored frontiers of another policy cannot be told apart without the fingerprint of the DSL parser
+    if (!frontierFile.empty() && policy::fingerprint<scheduler<model::time>>::value == 0) {
+        log<LOG_WARNING>("Incremental re-analysis is only supported for schedulers generated by the DSL parser");
+        frontierFile.clear();
+    }
+
+    auto inputs = tools::generateSegments<model::time>(model::tasks, model::segments, numHyperperiods);
+
+    tools::horizon<model::time> horizon;
+    horizon.numHyperperiods = numHyperperiods;
+    horizon.hyperperiod = tools::calHyperperiod(model::tasks);
+    horizon.jobsPerHyperperiod = inputs.size() / numHyperperiods;
+    horizon.timeScale = timeBase;
+
+    // search the largest scaling factor of the execution times instead of analyzing the model as it is
+    if (wantBreakdown || !sensitivityTask.empty()) {
+        sensitivity<model::time> search(inputs, model::tasks, model::systemEvents, model::processors, timeout,
+                                        wantBreakdown ? "" : sensitivityTask);
+        if (!search.scalesAny()) {
+            std::cerr << "No job of task " << sensitivityTask << " has an execution time to scale" << std::endl;
+            exit(1);
+        }
+        search.search();
+        std::cout << search.getFormattedOutput().str();
+        search.makeCSVFile(outputFile.substr(0, outputFile.find_last_of('.')) + "_sensitivity.csv");
+        return 0;
+    }
+
+    // decide the obvious task sets with the analytical tests, only the others are explored
+    screening::result verdict;
+    cpuTime screeningTime;
+    if (wantScreening) {
+        screeningTime.start();
+        verdict = screening::screen(model::tasks, model::segments, model::processors, model::systemEvents,
+                                    horizon.hyperperiod);
+        screeningTime.stop();
+    }
+
+    // look for a concrete schedule that misses a deadline
+    simulator<model::time> sim(inputs, model::systemEvents, model::processors);
+    if (!verdict.conclusive && numSimulations > 0) {
+        sim.simulate(numSimulations);
+        if (sim.foundMiss()) {
+            verdict.conclusive = true;
+            verdict.schedulable = false;
+            verdict.method = "Simulation";
+            screeningTime = sim.getTimer();
+            sim.makeCounterexampleFile(outputFile.substr(0, outputFile.find_last_of('.')) + "_counterexample.csv",
+                                       timeBase);
+        }
+    }
 
     // make analysis
-    auto ts = makeAnalysis<model::time>(inputs, model::systemEvents, model::processors);
+    auto ts = verdict.conclusive
+              ? transitionSystem<model::time>::constructScreened(outputFile, inputs, model::systemEvents,
+                                                                 model::processors, timeout, verdict.schedulable,
+                                                                 verdict.method, screeningTime)
+              : makeAnalysis<model::time>(inputs, model::systemEvents, model::processors, horizon);
+    ts.setTimeScale(timeBase);
+    if (numSimulations > 0 && !verdict.conclusive)
+        ts.setObservedCompletions(sim.getObservedCompletions(), sim.getNumRuns());
 
     if (rawFormat)
-        std::cout << ts.getRawOutput().str();
+        std::cout << ts.getRawOutput(wantScreening || numSimulations > 0 || wantFalsification).str();
     else
-        std::cout << ts.getFormattedOutput().str();
+        std::cout << ts.getFormattedOutput(wantStats).str();
 
     ts.makeCSVFile();
+    ts.makeWitnessFile();
 #ifdef COLLECT_TLTS_GRAPH
     ts.makeDotFile();
 #endif